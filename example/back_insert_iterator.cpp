@@ -4,9 +4,11 @@
 // accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 //[ back_insert_iterator
+#include <boost/stl_interfaces/algorithm.hpp>
 #include <boost/stl_interfaces/iterator_interface.hpp>
 
 #include <algorithm>
+#include <deque>
 #include <vector>
 
 #include <cassert>
@@ -45,6 +47,27 @@ struct back_insert_iterator : boost::stl_interfaces::iterator_interface<
         return *this;
     }
 
+    // Optional bulk-write members.  boost::stl_interfaces::copy() calls
+    // write_n() once for a contiguous source, instead of assigning each
+    // element.  For other random access sources, it calls reserve_hint()
+    // once before assigning each element.
+
+    // Same effect as n assignments of p[0] through p[n - 1].
+    back_insert_iterator &
+    write_n(typename Container::value_type const * p, std::size_t n)
+    {
+        c_->insert(c_->end(), p, p + n);
+        return *this;
+    }
+    // A hint that n elements are about to be written.  This only exists if
+    // Container has a reserve().
+    template<typename C = Container>
+    auto reserve_hint(std::size_t n)
+        -> decltype(std::declval<C &>().reserve(n), void())
+    {
+        c_->reserve(c_->size() + n);
+    }
+
     // Dereferencing *this just returns a reference to *this, so that the
     // expression *it = value uses the operator=() overloads above.
     back_insert_iterator & operator*() { return *this; }
@@ -79,5 +102,22 @@ int main()
     std::vector<int> ints_copy;
     std::copy(ints.begin(), ints.end(), ::back_inserter(ints_copy));
     assert(ints_copy == ints);
+
+    // The source is contiguous, so this is a single write_n() call, which
+    // appends all the elements with one insert().
+    std::vector<int> bulk_copy;
+    boost::stl_interfaces::copy(
+        ints.data(), ints.data() + ints.size(), ::back_inserter(bulk_copy));
+    assert(bulk_copy == ints);
+
+    // The source is not contiguous, but it is random access, so its size is
+    // known up front.  This reserves once, and then does one push_back() per
+    // element without reallocating.
+    std::deque<int> const int_deque(ints.begin(), ints.end());
+    std::vector<int> deque_copy;
+    boost::stl_interfaces::copy(
+        int_deque.begin(), int_deque.end(), ::back_inserter(deque_copy));
+    assert(deque_copy == ints);
+    assert(ints.size() <= deque_copy.capacity());
 }
 //]
@@ -0,0 +1,81 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "bit_vector.hpp"
+
+#include <cassert>
+
+
+int main()
+{
+    //[ bit_vector_usage
+    bit_vector live(200);
+    assert(live.size() == 200u);
+    assert(count(live.begin(), live.end(), true) == 0);
+
+    live[3] = true;
+    live[130] = true;
+    live.push_back(true);
+    assert(live.size() == 201u);
+    assert(count(live.begin(), live.end(), true) == 3);
+
+    // find() skips whole 64-bit words of zeros at a time.
+    auto it = find(live.begin(), live.end(), true);
+    assert(it - live.begin() == 3);
+    it = find(it + 1, live.end(), true);
+    assert(it - live.begin() == 130);
+
+    fill(live.begin() + 10, live.begin() + 150, true);
+    assert(count(live.begin(), live.end(), true) == 142);
+    assert(find_first_not_of(live.begin() + 10, live.end(), true) ==
+           live.begin() + 150);
+
+    // Unaligned copies still move a word at a time.
+    bit_vector other(201);
+    copy(live.begin() + 1, live.end(), other.begin() + 1);
+    other[0] = live[0];
+    assert(equal(live.begin(), live.end(), other.begin()));
+    assert(live == other); // Also compares a word at a time.
+    other[200].flip();
+    assert(live != other);
+
+    live.flip();
+    assert(count(live.begin(), live.end(), true) == 201 - 142);
+    //]
+
+    {
+        bit_vector v = {true, false, true, true};
+        v.insert(v.begin() + 1, 70, true);
+        assert(v.size() == 74u);
+        assert(count(v.begin(), v.end(), false) == 1);
+        assert(v[71] == false);
+
+        v.erase(v.begin(), v.begin() + 60);
+        assert(v.size() == 14u);
+        assert(v == (bit_vector{
+                        true, true, true, true, true, true, true,
+                        true, true, true, true, false, true, true}));
+
+        v.pop_back();
+        v.erase(v.begin() + 11);
+        assert(count(v.begin(), v.end(), true) == 12);
+        assert(find(v.cbegin(), v.cend(), false) == v.cend());
+    }
+
+    {
+        bit_vector v(1000);
+        for (int i = 0; i < 1000; i += 7) {
+            v[i] = true;
+        }
+        bit_vector const & cv = v;
+        int n = 0;
+        for (auto it = find(cv.begin(), cv.end(), true); it != cv.end();
+             it = find(it + 1, cv.end(), true)) {
+            assert((it - cv.begin()) % 7 == 0);
+            ++n;
+        }
+        assert(n == count(cv.begin(), cv.end(), true));
+    }
+}
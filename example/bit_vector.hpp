@@ -0,0 +1,494 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_EXAMPLE_BIT_VECTOR_HPP
+#define BOOST_STL_INTERFACES_EXAMPLE_BIT_VECTOR_HPP
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+
+namespace detail {
+    using bit_word = std::uint64_t;
+    constexpr std::ptrdiff_t bits_per_word = sizeof(bit_word) * CHAR_BIT;
+
+    inline int popcount(bit_word w) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(w);
+#else
+        int retval = 0;
+        for (; w; w &= w - 1) {
+            ++retval;
+        }
+        return retval;
+#endif
+    }
+
+    // w must not be 0.
+    inline int countr_zero(bit_word w) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(w);
+#else
+        int retval = 0;
+        for (; !(w & 1u); w >>= 1) {
+            ++retval;
+        }
+        return retval;
+#endif
+    }
+
+    // A word with the low n bits set, for 0 <= n <= bits_per_word.
+    constexpr bit_word low_mask(std::ptrdiff_t n) noexcept
+    {
+        return n == bits_per_word ? ~bit_word(0) : (bit_word(1) << n) - 1u;
+    }
+
+    // Reads n <= bits_per_word bits starting at bit position pos.
+    inline bit_word
+    get_bits(bit_word const * words, std::ptrdiff_t pos, std::ptrdiff_t n)
+    {
+        auto const word = pos / bits_per_word;
+        auto const offset = pos % bits_per_word;
+        bit_word retval = words[word] >> offset;
+        if (bits_per_word < offset + n)
+            retval |= words[word + 1] << (bits_per_word - offset);
+        return retval & low_mask(n);
+    }
+
+    // Writes the low n <= bits_per_word bits of bits starting at bit
+    // position pos.
+    inline void set_bits(
+        bit_word * words, std::ptrdiff_t pos, std::ptrdiff_t n, bit_word bits)
+    {
+        auto const word = pos / bits_per_word;
+        auto const offset = pos % bits_per_word;
+        auto const mask = low_mask(n);
+        bits &= mask;
+        words[word] = (words[word] & ~(mask << offset)) | (bits << offset);
+        if (bits_per_word < offset + n) {
+            auto const spill = bits_per_word - offset;
+            words[word + 1] =
+                (words[word + 1] & ~(mask >> spill)) | (bits >> spill);
+        }
+    }
+}
+
+//[ bit_vector_reference_defn
+// The proxy reference type for a mutable bit_vector iterator.  Assignment is
+// const, because the proxy refers to a bit elsewhere, just as a T * const
+// still refers to a mutable T.  This is what std::indirectly_writable
+// requires of proxy references.
+struct bit_reference
+{
+    bit_reference(detail::bit_word * word, detail::bit_word mask) noexcept :
+        word_(word), mask_(mask)
+    {}
+    // Copying makes another proxy for the same bit.  It must be declared,
+    // since an implicit copy constructor alongside the user-declared copy
+    // assignment below is deprecated.
+    bit_reference(bit_reference const &) = default;
+
+    operator bool() const noexcept { return (*word_ & mask_) != 0u; }
+
+    bit_reference const & operator=(bool b) const noexcept
+    {
+        if (b)
+            *word_ |= mask_;
+        else
+            *word_ &= ~mask_;
+        return *this;
+    }
+    bit_reference const & operator=(bit_reference const & other) const noexcept
+    {
+        return *this = bool(other);
+    }
+
+    void flip() const noexcept { *word_ ^= mask_; }
+
+    friend void swap(bit_reference lhs, bit_reference rhs) noexcept
+    {
+        bool const temp = lhs;
+        lhs = bool(rhs);
+        rhs = temp;
+    }
+
+private:
+    detail::bit_word * word_;
+    detail::bit_word mask_;
+};
+//]
+
+//[ bit_vector_iterator_defn
+// A random access proxy iterator over the bits in an array of words.  Its
+// state is just the array and an absolute bit position, so all the
+// random-access arithmetic is trivial; iterator_interface fills in the rest.
+template<bool Const>
+struct bit_iterator : boost::stl_interfaces::proxy_iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                          bit_iterator<Const>,
+#endif
+                          std::random_access_iterator_tag,
+                          bool,
+                          std::conditional_t<Const, bool, bit_reference>>
+{
+    using word_pointer = std::
+        conditional_t<Const, detail::bit_word const *, detail::bit_word *>;
+
+    bit_iterator() noexcept : words_(nullptr), pos_(0) {}
+    bit_iterator(word_pointer words, std::ptrdiff_t pos) noexcept :
+        words_(words), pos_(pos)
+    {}
+    template<
+        bool Const2,
+        typename E = std::enable_if_t<Const && !Const2>>
+    bit_iterator(bit_iterator<Const2> other) noexcept :
+        words_(other.words_), pos_(other.pos_)
+    {}
+
+    std::conditional_t<Const, bool, bit_reference> operator*() const noexcept
+    {
+        return deref(std::integral_constant<bool, Const>{});
+    }
+    bit_iterator & operator+=(std::ptrdiff_t n) noexcept
+    {
+        pos_ += n;
+        return *this;
+    }
+    std::ptrdiff_t operator-(bit_iterator other) const noexcept
+    {
+        return pos_ - other.pos_;
+    }
+
+    // These expose the underlying words to the word-level algorithms below.
+    word_pointer words() const noexcept { return words_; }
+    std::ptrdiff_t position() const noexcept { return pos_; }
+
+private:
+    template<bool Const2>
+    friend struct bit_iterator;
+
+    bool deref(std::true_type) const noexcept
+    {
+        return (words_[pos_ / detail::bits_per_word] >>
+                (pos_ % detail::bits_per_word)) &
+               1u;
+    }
+    bit_reference deref(std::false_type) const noexcept
+    {
+        return bit_reference(
+            words_ + pos_ / detail::bits_per_word,
+            detail::bit_word(1) << (pos_ % detail::bits_per_word));
+    }
+
+    word_pointer words_;
+    std::ptrdiff_t pos_;
+};
+//]
+
+//[ bit_vector_algorithms_defn
+// Word-level overloads of common algorithms.  Generic algorithms see one bool
+// per dereference, and pay for a shift, a mask, and a branch each time.
+// These overloads instead process 64 bits at a time, using popcount and
+// count-trailing-zeros, and only fall back to masking for the partial words
+// at the ends of the range.  They are found by ADL, so call them unqualified
+// (e.g. count(first, last, true), not std::count(first, last, true)).
+template<bool Const>
+std::ptrdiff_t count(bit_iterator<Const> first, bit_iterator<Const> last, bool b)
+{
+    auto const words = first.words();
+    auto pos = first.position();
+    auto const end = last.position();
+    std::ptrdiff_t retval = 0;
+    while (pos < end) {
+        auto const n = std::min(
+            end - pos,
+            detail::bits_per_word - pos % detail::bits_per_word);
+        retval += detail::popcount(detail::get_bits(words, pos, n));
+        pos += n;
+    }
+    return b ? retval : (end - first.position()) - retval;
+}
+
+template<bool Const>
+bit_iterator<Const>
+find(bit_iterator<Const> first, bit_iterator<Const> last, bool b)
+{
+    auto const words = first.words();
+    auto pos = first.position();
+    auto const end = last.position();
+    while (pos < end) {
+        auto const n = std::min(
+            end - pos,
+            detail::bits_per_word - pos % detail::bits_per_word);
+        auto bits = detail::get_bits(words, pos, n);
+        if (!b)
+            bits = ~bits & detail::low_mask(n);
+        if (bits)
+            return bit_iterator<Const>(words, pos + detail::countr_zero(bits));
+        pos += n;
+    }
+    return last;
+}
+
+// Returns the first position whose value is not b.
+template<bool Const>
+bit_iterator<Const> find_first_not_of(
+    bit_iterator<Const> first, bit_iterator<Const> last, bool b)
+{
+    return ::find(first, last, !b);
+}
+
+inline void fill(bit_iterator<false> first, bit_iterator<false> last, bool b)
+{
+    auto const words = first.words();
+    auto pos = first.position();
+    auto const end = last.position();
+    // The partial word at the front.
+    if (pos % detail::bits_per_word) {
+        auto const n = std::min(
+            end - pos,
+            detail::bits_per_word - pos % detail::bits_per_word);
+        detail::set_bits(words, pos, n, b ? ~detail::bit_word(0) : 0u);
+        pos += n;
+    }
+    // Whole words.
+    auto const whole_words = (end - pos) / detail::bits_per_word;
+    std::fill_n(
+        words + pos / detail::bits_per_word,
+        whole_words,
+        b ? ~detail::bit_word(0) : detail::bit_word(0));
+    pos += whole_words * detail::bits_per_word;
+    // The partial word at the back.
+    if (pos < end)
+        detail::set_bits(words, pos, end - pos, b ? ~detail::bit_word(0) : 0u);
+}
+
+// Like std::copy(), out must not be in [first, last).
+template<bool Const>
+bit_iterator<false> copy(
+    bit_iterator<Const> first, bit_iterator<Const> last, bit_iterator<false> out)
+{
+    auto const in_words = first.words();
+    auto const out_words = out.words();
+    auto in = first.position();
+    auto out_pos = out.position();
+    auto const end = last.position();
+    while (in < end) {
+        auto const n = std::min(end - in, detail::bits_per_word);
+        detail::set_bits(
+            out_words, out_pos, n, detail::get_bits(in_words, in, n));
+        in += n;
+        out_pos += n;
+    }
+    return bit_iterator<false>(out_words, out_pos);
+}
+
+// Like std::copy_backward(), out must not be in (first, last].
+template<bool Const>
+bit_iterator<false> copy_backward(
+    bit_iterator<Const> first, bit_iterator<Const> last, bit_iterator<false> out)
+{
+    auto const in_words = first.words();
+    auto const out_words = out.words();
+    auto const begin = first.position();
+    auto in = last.position();
+    auto out_pos = out.position();
+    while (begin < in) {
+        auto const n = std::min(in - begin, detail::bits_per_word);
+        in -= n;
+        out_pos -= n;
+        detail::set_bits(
+            out_words, out_pos, n, detail::get_bits(in_words, in, n));
+    }
+    return bit_iterator<false>(out_words, out_pos);
+}
+
+template<bool Const1, bool Const2>
+bool equal(
+    bit_iterator<Const1> first1,
+    bit_iterator<Const1> last1,
+    bit_iterator<Const2> first2)
+{
+    auto const words1 = first1.words();
+    auto const words2 = first2.words();
+    auto pos1 = first1.position();
+    auto pos2 = first2.position();
+    auto const end = last1.position();
+    while (pos1 < end) {
+        auto const n = std::min(end - pos1, detail::bits_per_word);
+        if (detail::get_bits(words1, pos1, n) !=
+            detail::get_bits(words2, pos2, n)) {
+            return false;
+        }
+        pos1 += n;
+        pos2 += n;
+    }
+    return true;
+}
+//]
+
+//[ bit_vector_defn
+// A packed vector of bools.  It is built on sequence_container_interface just
+// like static_vector, except that its iterators are proxy iterators.  Bits
+// past size() in the last word are always kept zero.
+struct bit_vector : boost::stl_interfaces::sequence_container_interface<bit_vector>
+{
+    using value_type = bool;
+    using reference = bit_reference;
+    using const_reference = bool;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = bit_iterator<false>;
+    using const_iterator = bit_iterator<true>;
+    using reverse_iterator = boost::stl_interfaces::reverse_iterator<iterator>;
+    using const_reverse_iterator =
+        boost::stl_interfaces::reverse_iterator<const_iterator>;
+
+    // The std::vector member takes care of all the special members for us.
+    bit_vector() noexcept : size_(0) {}
+    explicit bit_vector(size_type n, bool b = false) : size_(0) { resize(n, b); }
+    template<
+        typename InputIterator,
+        typename Enable = std::enable_if_t<std::is_convertible<
+            typename std::iterator_traits<InputIterator>::iterator_category,
+            std::input_iterator_tag>::value>>
+    bit_vector(InputIterator first, InputIterator last) : size_(0)
+    {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+    bit_vector(std::initializer_list<bool> il) :
+        bit_vector(il.begin(), il.end())
+    {}
+
+    iterator begin() noexcept { return iterator(words_.data(), 0); }
+    iterator end() noexcept { return iterator(words_.data(), size_); }
+
+    size_type max_size() const noexcept { return words_.max_size(); }
+    size_type capacity() const noexcept
+    {
+        return words_.capacity() * detail::bits_per_word;
+    }
+    void reserve(size_type n) { words_.reserve(words_for(n)); }
+    void shrink_to_fit() { words_.shrink_to_fit(); }
+    void resize(size_type n, bool b = false)
+    {
+        auto const old_size = size_;
+        words_.resize(words_for(n), 0u);
+        size_ = n;
+        if (old_size < n)
+            ::fill(begin() + old_size, end(), b);
+        else
+            clear_tail();
+    }
+
+    // The underlying words, for code that wants to do its own bit twiddling.
+    detail::bit_word const * words() const noexcept { return words_.data(); }
+
+    bit_reference emplace_back(bool b)
+    {
+        if (size_ == words_.size() * detail::bits_per_word)
+            words_.push_back(0u);
+        ++size_;
+        auto const retval = *(end() - 1);
+        retval = b;
+        return retval;
+    }
+    iterator emplace(const_iterator pos, bool b)
+    {
+        auto const i = pos - this->begin();
+        emplace_back(false);
+        auto const position = begin() + i;
+        ::copy_backward(position, end() - 1, end());
+        *position = b;
+        return position;
+    }
+
+    template<
+        typename ForwardIterator,
+        typename Enable = std::enable_if_t<std::is_convertible<
+            typename std::iterator_traits<ForwardIterator>::iterator_category,
+            std::forward_iterator_tag>::value>>
+    iterator
+    insert(const_iterator pos, ForwardIterator first, ForwardIterator last)
+    {
+        auto const i = pos - this->begin();
+        auto const insertions = std::distance(first, last);
+        auto const old_end = size_;
+        resize(size_ + insertions);
+        auto const position = begin() + i;
+        ::copy_backward(position, begin() + old_end, end());
+        std::copy(first, last, position);
+        return position;
+    }
+
+    iterator erase(const_iterator f, const_iterator l)
+    {
+        auto const first = begin() + (f - this->begin());
+        auto const last = begin() + (l - this->begin());
+        auto const new_end = ::copy(last, end(), first);
+        resize(new_end - begin());
+        return first;
+    }
+
+    void swap(bit_vector & other)
+    {
+        std::swap(words_, other.words_);
+        std::swap(size_, other.size_);
+    }
+    void clear() noexcept
+    {
+        words_.clear();
+        size_ = 0;
+    }
+
+    // This is preferred to the bit-by-bit operator==() that
+    // sequence_container_interface provides.
+    friend bool operator==(bit_vector const & lhs, bit_vector const & rhs)
+    {
+        return lhs.size() == rhs.size() &&
+               ::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    void flip() noexcept
+    {
+        for (auto & w : words_) {
+            w = ~w;
+        }
+        clear_tail();
+    }
+
+    using base_type =
+        boost::stl_interfaces::sequence_container_interface<bit_vector>;
+    using base_type::begin;
+    using base_type::end;
+    using base_type::insert;
+    using base_type::erase;
+
+private:
+    static size_type words_for(size_type bits) noexcept
+    {
+        return (bits + detail::bits_per_word - 1) / detail::bits_per_word;
+    }
+    void clear_tail() noexcept
+    {
+        auto const used = size_ % detail::bits_per_word;
+        if (used)
+            words_.back() &= detail::low_mask(used);
+    }
+
+    std::vector<detail::bit_word> words_;
+    size_type size_;
+};
+//]
+
+#endif
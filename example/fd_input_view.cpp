@@ -0,0 +1,104 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "fd_input_view.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <fcntl.h>
+
+
+//[ fd_input_view_count_lines
+// Counts newlines a whole buffer at a time, using memchr().
+std::size_t count_lines(fd_input_view & input)
+{
+    std::size_t retval = 0;
+    for (auto chunk = input.chunk(); !chunk.empty(); chunk = input.chunk()) {
+        char const * first = chunk.data();
+        char const * const last = first + chunk.size();
+        while (char const * nl = static_cast<char const *>(
+                   std::memchr(first, '\n', last - first))) {
+            ++retval;
+            first = nl + 1;
+        }
+        input.consume(chunk.size());
+    }
+    return retval;
+}
+//]
+
+int main()
+{
+    char const * const path = "fd_input_view_example.log";
+    std::string contents;
+    for (int i = 0; i < 10000; ++i) {
+        contents += "request " + std::to_string(i) + " ok\n";
+    }
+    {
+        std::ofstream ofs(path, std::ios::binary);
+        ofs << contents;
+    }
+
+    {
+        //[ fd_input_view_usage
+        int const fd = ::open(path, O_RDONLY);
+        fd_input_view input(fd);
+        assert(count_lines(input) == 10000u);
+        assert(input.exhausted());
+        ::close(fd);
+        //]
+    }
+
+    {
+        // A tiny buffer, so that the iterator crosses many refills.  Note that
+        // in C++20 and later, this is a std::input_iterator, but not a
+        // C++17 input iterator, so we use a loop instead of std::copy().
+        int const fd = ::open(path, O_RDONLY);
+        fd_input_view input(fd, 7);
+        std::string copy;
+        for (char c : input) {
+            copy += c;
+        }
+        assert(copy == contents);
+        assert(input.begin() == input.end());
+        ::close(fd);
+    }
+
+    {
+        // Mixing bulk and byte-at-a-time access.
+        int const fd = ::open(path, O_RDONLY);
+        fd_input_view input(fd, 13);
+        auto it = input.begin();
+        assert(*it == 'r');
+        auto const chunk = input.chunk();
+        assert(chunk.size() == 13);
+        assert(std::equal(chunk.begin(), chunk.end(), contents.begin()));
+        input.consume(8);
+        assert(*it == '0');
+        ++it;
+        assert(*it == ' ');
+        it++;
+        assert(*it == 'o');
+        std::string rest;
+        for (; it != input.end(); ++it) {
+            rest += *it;
+        }
+        assert(rest == contents.substr(10));
+        ::close(fd);
+    }
+
+    {
+        fd_input_view empty;
+        assert(empty.exhausted());
+        assert(empty.begin() == empty.end());
+    }
+
+    std::remove(path);
+}
@@ -0,0 +1,175 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_EXAMPLE_FD_INPUT_VIEW_HPP
+#define BOOST_STL_INTERFACES_EXAMPLE_FD_INPUT_VIEW_HPP
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <system_error>
+
+#include <unistd.h>
+
+
+struct fd_input_view;
+
+//[ fd_input_iterator_defn
+// An input iterator over the bytes of a file descriptor.  All the state lives
+// in the fd_input_view; the iterator is just a pointer to it, which is what
+// makes it single-pass: incrementing any copy advances all of them.
+//
+// A default-constructed iterator is the end iterator.  Any iterator compares
+// equal to it once the input is exhausted.
+struct fd_input_iterator : boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                               fd_input_iterator,
+#endif
+                               std::input_iterator_tag,
+                               char,
+                               char>
+{
+    fd_input_iterator() noexcept : view_(nullptr) {}
+    explicit fd_input_iterator(fd_input_view * view) noexcept : view_(view) {}
+
+    inline char operator*() const noexcept;
+    inline fd_input_iterator & operator++();
+
+    friend bool operator==(fd_input_iterator lhs, fd_input_iterator rhs) noexcept
+    {
+        return lhs.at_end() == rhs.at_end();
+    }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+        fd_input_iterator,
+#endif
+        std::input_iterator_tag,
+        char,
+        char>;
+    using base_type::operator++;
+
+private:
+    inline bool at_end() const noexcept;
+
+    fd_input_view * view_;
+};
+//]
+
+//[ fd_input_view_defn
+// The bytes in a contiguous chunk of the buffer.
+struct fd_input_chunk : boost::stl_interfaces::view_interface<
+                            fd_input_chunk,
+                            boost::stl_interfaces::element_layout::contiguous>
+{
+    fd_input_chunk() noexcept : first_(nullptr), last_(nullptr) {}
+    fd_input_chunk(char const * first, char const * last) noexcept :
+        first_(first), last_(last)
+    {}
+
+    char const * begin() const noexcept { return first_; }
+    char const * end() const noexcept { return last_; }
+
+private:
+    char const * first_;
+    char const * last_;
+};
+
+// Reads a file descriptor through a large buffer, one read() per buffer-full.
+// Byte-at-a-time code can use begin() and end(); code that wants to scan in
+// bulk (say, with memchr()) can use chunk() and consume() instead, and mix
+// the two freely.
+//
+// The view does not own the file descriptor.  Iterators point to the view,
+// so moving the view invalidates them.
+struct fd_input_view : boost::stl_interfaces::view_interface<fd_input_view>
+{
+    static constexpr std::size_t default_buffer_size = 64 * 1024;
+
+    fd_input_view() noexcept : fd_(-1), size_(0), first_(0), last_(0) {}
+    explicit fd_input_view(
+        int fd, std::size_t buffer_size = default_buffer_size) :
+        fd_(fd),
+        buffer_(new char[buffer_size]),
+        size_(buffer_size),
+        first_(0),
+        last_(0)
+    {}
+
+    fd_input_iterator begin()
+    {
+        fill_if_empty();
+        return fd_input_iterator(this);
+    }
+    fd_input_iterator end() noexcept { return fd_input_iterator(); }
+
+    // Returns all the bytes currently buffered, reading more first if there
+    // are none.  An empty chunk means the input is exhausted.  Throws
+    // std::system_error if read() fails.
+    fd_input_chunk chunk()
+    {
+        fill_if_empty();
+        return fd_input_chunk(buffer_.get() + first_, buffer_.get() + last_);
+    }
+
+    // Marks the first n bytes of chunk() as used, reading more if that was
+    // all of them.
+    void consume(std::size_t n)
+    {
+        first_ += n;
+        fill_if_empty();
+    }
+
+    bool exhausted() { return chunk().empty(); }
+
+private:
+    friend fd_input_iterator;
+
+    void fill_if_empty()
+    {
+        if (first_ != last_ || fd_ < 0)
+            return;
+        first_ = last_ = 0;
+        ssize_t n = 0;
+        do {
+            n = ::read(fd_, buffer_.get(), size_);
+        } while (n < 0 && errno == EINTR);
+        if (n < 0)
+            throw std::system_error(errno, std::generic_category());
+        last_ = std::size_t(n);
+        if (!n)
+            fd_ = -1;
+    }
+
+    int fd_;
+    std::unique_ptr<char[]> buffer_;
+    std::size_t size_;
+    std::size_t first_;
+    std::size_t last_;
+};
+//]
+
+char fd_input_iterator::operator*() const noexcept
+{
+    return view_->buffer_[view_->first_];
+}
+
+// Refilling eagerly here means that operator*() and operator==() never need
+// to read().
+fd_input_iterator & fd_input_iterator::operator++()
+{
+    ++view_->first_;
+    view_->fill_if_empty();
+    return *this;
+}
+
+bool fd_input_iterator::at_end() const noexcept
+{
+    return !view_ || view_->first_ == view_->last_;
+}
+
+#endif
@@ -0,0 +1,109 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "fd_output_iterator.hpp"
+
+#include <boost/stl_interfaces/algorithm.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+
+
+std::string read_file(char const * path)
+{
+    std::ifstream ifs(path, std::ios::binary);
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    return oss.str();
+}
+
+int main()
+{
+    char const * const path = "fd_output_iterator_example.tsv";
+
+    {
+        //[ fd_output_iterator_usage
+        int const fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        {
+            fd_writer writer(fd);
+            fd_output_iterator out(writer);
+
+            // A TSV row, written one field at a time.
+            *out++ = "id";
+            *out++ = '\t';
+            *out++ = -42;
+            *out++ = '\t';
+            *out++ = 0.5;
+            *out++ = '\n';
+
+            // With a delimiter, this works like std::ostream_iterator.
+            std::vector<int> const ids = {1, 22, 333};
+            std::copy(ids.begin(), ids.end(), fd_output_iterator(writer, "\t"));
+            *out++ = '\n';
+
+            // Nothing has been written to the file yet.
+            assert(writer.buffered() == 21u);
+        } // The writer flushes on destruction.
+        ::close(fd);
+
+        assert(read_file(path) == "id\t-42\t0.5\n1\t22\t333\t\n");
+        //]
+    }
+
+    {
+        // Explicit flushes, a buffer small enough to fill up, and bulk writes
+        // through boost::stl_interfaces::copy().
+        int const fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        std::string expected;
+        {
+            fd_writer writer(fd, 100, flush_policy::explicit_only);
+            fd_output_iterator out(writer);
+            std::string const line = "a line of text that is not short\n";
+            std::string const min =
+                std::to_string(std::numeric_limits<long long>::min());
+            for (int i = 0; i < 1000; ++i) {
+                boost::stl_interfaces::copy(
+                    line.data(), line.data() + line.size(), out);
+                *out++ = i;
+                *out++ = ',';
+                *out++ = std::numeric_limits<long long>::min();
+                *out++ = '\n';
+                expected += line + std::to_string(i) + "," + min + "\n";
+            }
+            std::string const big(1000, 'x');
+            out = big;
+            expected += big;
+            writer.flush();
+            assert(writer.buffered() == 0u);
+            *out++ = 'y';
+        } // No flush here; the 'y' is lost.
+        ::close(fd);
+        assert(read_file(path) == expected);
+    }
+
+    {
+        int const fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        {
+            fd_writer writer(fd);
+            fd_output_iterator out(writer, ",");
+            char const chars[] = {'a', 'b', 'c'};
+            boost::stl_interfaces::copy(chars, chars + 3, out);
+            *out++ = 1.25f;
+            *out++ = 7u;
+        }
+        ::close(fd);
+        assert(read_file(path) == "a,b,c,1.25,7,");
+    }
+
+    std::remove(path);
+}
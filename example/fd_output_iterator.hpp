@@ -0,0 +1,270 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_EXAMPLE_FD_OUTPUT_ITERATOR_HPP
+#define BOOST_STL_INTERFACES_EXAMPLE_FD_OUTPUT_ITERATOR_HPP
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#if 201703L <= __cplusplus && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <unistd.h>
+
+
+//[ fd_writer_defn
+enum class flush_policy { on_destroy, explicit_only };
+
+// Writes to a file descriptor through a large buffer, one write() per
+// buffer-full.  Numbers are formatted straight into the buffer with
+// std::to_chars() where it is available; there is no locale, no stream
+// state, and no locking.
+//
+// With flush_policy::on_destroy, the destructor flushes whatever is left in
+// the buffer, and ignores any errors, since it cannot report them.  Call
+// flush() explicitly to find out whether all the writes succeeded.
+struct fd_writer
+{
+    static constexpr std::size_t default_buffer_size = 64 * 1024;
+    // Enough for any arithmetic value formatted by format().
+    static constexpr std::size_t max_formatted_size = 64;
+
+    explicit fd_writer(
+        int fd,
+        std::size_t buffer_size = default_buffer_size,
+        flush_policy policy = flush_policy::on_destroy) :
+        fd_(fd),
+        size_(
+            buffer_size < max_formatted_size ? max_formatted_size
+                                             : buffer_size),
+        buffer_(new char[size_]),
+        used_(0),
+        policy_(policy)
+    {}
+    fd_writer(fd_writer const &) = delete;
+    fd_writer & operator=(fd_writer const &) = delete;
+    ~fd_writer()
+    {
+        if (policy_ != flush_policy::on_destroy)
+            return;
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+
+    void put(char c)
+    {
+        if (used_ == size_)
+            flush();
+        buffer_[used_++] = c;
+    }
+
+    // Large writes bypass the buffer instead of being copied through it.
+    void write(char const * p, std::size_t n)
+    {
+        if (size_ - used_ < n) {
+            flush();
+            if (size_ <= n) {
+                write_all(p, n);
+                return;
+            }
+        }
+        std::memcpy(buffer_.get() + used_, p, n);
+        used_ += n;
+    }
+
+    template<typename T>
+    void format(T x)
+    {
+        static_assert(std::is_arithmetic<T>::value, "");
+        if (size_ - used_ < max_formatted_size)
+            flush();
+        used_ = format_impl(buffer_.get() + used_, x) - buffer_.get();
+    }
+
+    // Writes out the buffer.  Throws std::system_error if write() fails.
+    void flush()
+    {
+        auto const n = used_;
+        used_ = 0;
+        write_all(buffer_.get(), n);
+    }
+
+    std::size_t buffered() const noexcept { return used_; }
+
+private:
+    void write_all(char const * p, std::size_t n)
+    {
+        while (n) {
+            auto const written = ::write(fd_, p, n);
+            if (written < 0) {
+                if (errno == EINTR)
+                    continue;
+                throw std::system_error(errno, std::generic_category());
+            }
+            p += written;
+            n -= std::size_t(written);
+        }
+    }
+
+#if defined(__cpp_lib_to_chars)
+    template<typename T>
+    static char * format_impl(char * out, T x)
+    {
+        return std::to_chars(out, out + max_formatted_size, x).ptr;
+    }
+#else
+    template<typename T>
+    static char * format_impl(char * out, T x)
+    {
+        return format_impl(out, x, std::is_integral<T>{});
+    }
+    // Without std::to_chars(), integers are converted by hand, and floating
+    // point values go through snprintf() with enough digits to round-trip.
+    template<typename T>
+    static char * format_impl(char * out, T x, std::true_type)
+    {
+        using unsigned_type = std::make_unsigned_t<T>;
+        unsigned_type u = unsigned_type(x);
+        if (x < T(0)) {
+            *out++ = '-';
+            u = unsigned_type(0) - u;
+        }
+        char digits[std::numeric_limits<unsigned_type>::digits10 + 1];
+        char * first = std::end(digits);
+        do {
+            *--first = char('0' + u % 10u);
+            u /= 10u;
+        } while (u);
+        return std::copy(first, std::end(digits), out);
+    }
+    template<typename T>
+    static char * format_impl(char * out, T x, std::false_type)
+    {
+        int const n = std::snprintf(
+            out,
+            max_formatted_size,
+            "%.*Lg",
+            std::numeric_limits<T>::max_digits10,
+            static_cast<long double>(x));
+        return out + n;
+    }
+#endif
+
+    int fd_;
+    std::size_t size_;
+    std::unique_ptr<char[]> buffer_;
+    std::size_t used_;
+    flush_policy policy_;
+};
+//]
+
+//[ fd_output_iterator_defn
+// An output iterator that writes to an fd_writer.  Like std::ostream_iterator,
+// it writes an optional delimiter after each value.  Unlike
+// std::ostream_iterator, it is not limited to one value type; characters and
+// strings are written as-is, and other arithmetic types are formatted.
+//
+// It also provides write_n(), so copying a contiguous range of chars through
+// boost::stl_interfaces::copy() becomes a single memcpy() into the buffer.
+struct fd_output_iterator : boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                                fd_output_iterator,
+#endif
+                                std::output_iterator_tag,
+                                char,
+                                fd_output_iterator &>
+{
+    fd_output_iterator() noexcept : writer_(nullptr), delim_(nullptr) {}
+    explicit fd_output_iterator(
+        fd_writer & writer, char const * delim = nullptr) noexcept :
+        writer_(std::addressof(writer)), delim_(delim)
+    {}
+
+    fd_output_iterator & operator=(char c)
+    {
+        writer_->put(c);
+        return delimit();
+    }
+    fd_output_iterator & operator=(char const * s)
+    {
+        writer_->write(s, std::strlen(s));
+        return delimit();
+    }
+    fd_output_iterator & operator=(std::string const & s)
+    {
+        writer_->write(s.data(), s.size());
+        return delimit();
+    }
+    template<
+        typename T,
+        typename Enable = std::enable_if_t<
+            std::is_arithmetic<T>::value && !std::is_same<T, char>::value &&
+            !std::is_same<T, bool>::value>>
+    fd_output_iterator & operator=(T x)
+    {
+        writer_->format(x);
+        return delimit();
+    }
+    // Without this, a bool would convert to char, and write a '\x01' or
+    // '\0' byte.  There is no one right way to spell a bool, so callers
+    // must pick one.
+    fd_output_iterator & operator=(bool) = delete;
+
+    // Writes the n chars in p.  With no delimiter, this is a single write()
+    // to the buffer.  With one, it falls back to writing one char at a time,
+    // so that it has the same effect as n assignments, as write_n() must.
+    fd_output_iterator & write_n(char const * p, std::size_t n)
+    {
+        if (delim_) {
+            for (std::size_t i = 0; i < n; ++i) {
+                *this = p[i];
+            }
+        } else {
+            writer_->write(p, n);
+        }
+        return *this;
+    }
+
+    fd_output_iterator & operator*() noexcept { return *this; }
+    fd_output_iterator & operator++() noexcept { return *this; }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+        fd_output_iterator,
+#endif
+        std::output_iterator_tag,
+        char,
+        fd_output_iterator &>;
+    using base_type::operator++;
+
+private:
+    fd_output_iterator & delimit()
+    {
+        if (delim_)
+            writer_->write(delim_, std::strlen(delim_));
+        return *this;
+    }
+
+    fd_writer * writer_;
+    char const * delim_;
+};
+//]
+
+#endif
@@ -0,0 +1,64 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "flat_map.hpp"
+
+#include <string>
+
+#include <cassert>
+
+
+int main()
+{
+    //[ flat_map_usage
+    flat_map<int, std::string> map = {{3, "three"}, {1, "one"}};
+    assert(map.size() == 2u);
+    assert((*map.begin()).first == 1);
+    assert(map.at(3) == "three");
+
+    map[2] = "two";
+    assert(map.keys() == (std::vector<int>{1, 2, 3}));
+
+    // New keys are sorted and merged in one pass.  Existing keys keep their
+    // mapped values.
+    std::vector<std::pair<int, std::string>> const batch = {
+        {5, "five"}, {0, "zero"}, {3, "THREE"}, {4, "four"}};
+    map.insert(batch.begin(), batch.end());
+    assert(map.keys() == (std::vector<int>{0, 1, 2, 3, 4, 5}));
+    assert(
+        map.values() ==
+        (std::vector<std::string>{"zero", "one", "two", "three", "four", "five"}));
+
+    // Writing through an iterator changes the mapped value, never the key.
+    (*map.find(4)).second = "FOUR";
+    assert(map.at(4) == "FOUR");
+
+    assert(map.erase(0) == 1u);
+    assert(map.erase(0) == 0u);
+    assert(!map.contains(0));
+    assert(map.front().first == 1);
+    assert(map.back().second == "five");
+    //]
+
+    {
+        flat_map<int, int> m;
+        std::vector<std::pair<int, int>> batch;
+        for (int i = 0; i < 100; ++i) {
+            batch.push_back({(i * 37) % 101, i});
+        }
+        m.insert(batch.begin(), batch.end());
+        m.insert(batch.begin(), batch.end());
+        assert(m.size() == 100u);
+        assert(std::is_sorted(m.keys().begin(), m.keys().end()));
+        for (auto const & x : batch) {
+            assert(m.at(x.first) == x.second);
+        }
+
+        flat_map<int, int> const & cm = m;
+        assert(cm == m);
+        assert(cm.lower_bound(37) == cm.find(37));
+        assert(cm.upper_bound(37) == std::next(cm.find(37)));
+    }
+}
@@ -0,0 +1,391 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_EXAMPLE_FLAT_MAP_HPP
+#define BOOST_STL_INTERFACES_EXAMPLE_FLAT_MAP_HPP
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+//[ flat_map_iterator_defn
+// flat_map keeps its keys and its mapped values in two separate columns, so
+// there is no std::pair<Key, T> object anywhere for an iterator to refer to.
+// Instead, the iterator is a proxy iterator (much like the zip iterator
+// example) whose reference type is a pair of references into the two
+// columns.
+//
+// The reference type is a thin wrapper around std::pair, rather than a
+// std::pair itself.  In C++20, std::ranges requires an iterator's reference
+// and value types to have a common reference, and before C++23 a pair of
+// references and a pair of values do not.  We are allowed to specialize
+// std::basic_common_reference for our own type, but not for std::pair.
+template<typename Key, typename T, typename MappedRef>
+struct flat_map_reference : std::pair<Key const &, MappedRef>
+{
+    using std::pair<Key const &, MappedRef>::pair;
+};
+
+template<typename Key, typename T, typename MappedRef>
+struct flat_map_iterator
+    : boost::stl_interfaces::proxy_iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+          flat_map_iterator<Key, T, MappedRef>,
+#endif
+          std::random_access_iterator_tag,
+          std::pair<Key, T>,
+          flat_map_reference<Key, T, MappedRef>>
+{
+    using mapped_pointer = std::remove_reference_t<MappedRef> *;
+
+    constexpr flat_map_iterator() noexcept : key_(), mapped_() {}
+    constexpr flat_map_iterator(
+        Key const * key, mapped_pointer mapped) noexcept :
+        key_(key), mapped_(mapped)
+    {}
+
+    // Mutable-to-constant conversion.
+    template<
+        typename MappedRef2,
+        typename E = std::enable_if_t<std::is_convertible<
+            std::remove_reference_t<MappedRef2> *,
+            mapped_pointer>::value>>
+    constexpr flat_map_iterator(
+        flat_map_iterator<Key, T, MappedRef2> other) noexcept :
+        key_(other.key_), mapped_(other.mapped_)
+    {}
+
+    constexpr flat_map_reference<Key, T, MappedRef> operator*() const noexcept
+    {
+        return {*key_, *mapped_};
+    }
+    constexpr flat_map_iterator & operator+=(std::ptrdiff_t i) noexcept
+    {
+        key_ += i;
+        mapped_ += i;
+        return *this;
+    }
+    constexpr auto operator-(flat_map_iterator other) const noexcept
+    {
+        return key_ - other.key_;
+    }
+
+    // The position of this iterator in the keys column; this is what lets
+    // lookups do their binary search over contiguous keys only.
+    constexpr Key const * key_ptr() const noexcept { return key_; }
+
+private:
+    template<typename Key2, typename T2, typename MappedRef2>
+    friend struct flat_map_iterator;
+
+    Key const * key_;
+    mapped_pointer mapped_;
+};
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+namespace std {
+    template<
+        typename Key,
+        typename T,
+        typename MappedRef,
+        template<class> class TQual,
+        template<class> class UQual>
+    struct basic_common_reference<
+        flat_map_reference<Key, T, MappedRef>,
+        std::pair<Key, T>,
+        TQual,
+        UQual>
+    {
+        using type = std::pair<Key, T>;
+    };
+    template<
+        typename Key,
+        typename T,
+        typename MappedRef,
+        template<class> class TQual,
+        template<class> class UQual>
+    struct basic_common_reference<
+        std::pair<Key, T>,
+        flat_map_reference<Key, T, MappedRef>,
+        TQual,
+        UQual>
+    {
+        using type = std::pair<Key, T>;
+    };
+}
+#endif
+//]
+
+//[ flat_map_defn
+// A sorted, unique-key map.  The keys live in one contiguous std::vector, and
+// the mapped values in another, so binary searches only touch keys, and a
+// scan over the keys never drags the (possibly large) mapped values through
+// the cache.
+//
+// Since the iterator is a proxy, the elements are not contiguous, and we get
+// the default element_layout::discontiguous.
+template<typename Key, typename T, typename Compare = std::less<Key>>
+struct flat_map : boost::stl_interfaces::sequence_container_interface<
+                      flat_map<Key, T, Compare>>
+{
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using reference = flat_map_reference<Key, T, T &>;
+    using const_reference = flat_map_reference<Key, T, T const &>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = flat_map_iterator<Key, T, T &>;
+    using const_iterator = flat_map_iterator<Key, T, T const &>;
+    using reverse_iterator = boost::stl_interfaces::reverse_iterator<iterator>;
+    using const_reverse_iterator =
+        boost::stl_interfaces::reverse_iterator<const_iterator>;
+
+    // The std::vector members take care of all the special members for us.
+    flat_map() = default;
+    explicit flat_map(Compare const & comp) : comp_(comp) {}
+    template<
+        typename InputIterator,
+        typename Enable = std::enable_if_t<std::is_convertible<
+            typename std::iterator_traits<InputIterator>::iterator_category,
+            std::input_iterator_tag>::value>>
+    flat_map(
+        InputIterator first,
+        InputIterator last,
+        Compare const & comp = Compare()) :
+        comp_(comp)
+    {
+        insert(first, last);
+    }
+    flat_map(
+        std::initializer_list<value_type> il,
+        Compare const & comp = Compare()) :
+        flat_map(il.begin(), il.end(), comp)
+    {}
+
+    iterator begin() noexcept { return iterator(keys_.data(), values_.data()); }
+    iterator end() noexcept
+    {
+        return iterator(
+            keys_.data() + keys_.size(), values_.data() + values_.size());
+    }
+
+    size_type max_size() const noexcept { return keys_.max_size(); }
+    size_type capacity() const noexcept { return keys_.capacity(); }
+    void reserve(size_type n)
+    {
+        keys_.reserve(n);
+        values_.reserve(n);
+    }
+    void shrink_to_fit()
+    {
+        keys_.shrink_to_fit();
+        values_.shrink_to_fit();
+    }
+
+    // Direct access to the columns.
+    std::vector<Key> const & keys() const noexcept { return keys_; }
+    std::vector<T> const & values() const noexcept { return values_; }
+
+    // This operator[] hides the positional one that
+    // sequence_container_interface would otherwise provide.
+    T & operator[](Key const & k) { return (*try_emplace(k).first).second; }
+    T & at(Key const & k)
+    {
+        auto const it = find(k);
+        if (it == end())
+            throw std::out_of_range("Key not found in flat_map::at()");
+        return (*it).second;
+    }
+    T const & at(Key const & k) const
+    {
+        auto const it = find(k);
+        if (it == this->end())
+            throw std::out_of_range("Key not found in flat_map::at()");
+        return (*it).second;
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key const & k, Args &&... args)
+    {
+        auto const i = lower_bound_index(k);
+        if (i != keys_.size() && !comp_(k, keys_[i]))
+            return {begin() + i, false};
+        keys_.insert(keys_.begin() + i, k);
+        values_.emplace(values_.begin() + i, std::forward<Args>(args)...);
+        return {begin() + i, true};
+    }
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args &&... args)
+    {
+        value_type x(std::forward<Args>(args)...);
+        return try_emplace(x.first, std::move(x.second));
+    }
+    std::pair<iterator, bool> insert(value_type const & x)
+    {
+        return try_emplace(x.first, x.second);
+    }
+    std::pair<iterator, bool> insert(value_type && x)
+    {
+        return try_emplace(x.first, std::move(x.second));
+    }
+
+    // This is the bulk-insertion path.  Inserting M elements one at a time
+    // costs M binary searches, plus M shifts of each column's tail.  Instead,
+    // we sort the new elements once, drop the ones whose keys are already
+    // present, and then merge backward from the end of each column, so that
+    // every existing element moves at most once.  As with std::flat_map,
+    // existing keys win over new ones, and among new elements with
+    // equivalent keys, only one survives.
+    template<
+        typename InputIterator,
+        typename Enable = std::enable_if_t<std::is_convertible<
+            typename std::iterator_traits<InputIterator>::iterator_category,
+            std::input_iterator_tag>::value>>
+    void insert(InputIterator first, InputIterator last)
+    {
+        std::vector<value_type> batch(first, last);
+        if (batch.empty())
+            return;
+
+        auto const key_less = [this](
+                                  value_type const & lhs,
+                                  value_type const & rhs) {
+            return comp_(lhs.first, rhs.first);
+        };
+        std::sort(batch.begin(), batch.end(), key_less);
+        auto const key_equiv = [this](
+                                   value_type const & lhs,
+                                   value_type const & rhs) {
+            return !comp_(lhs.first, rhs.first);
+        };
+        batch.erase(
+            std::unique(batch.begin(), batch.end(), key_equiv), batch.end());
+
+        // Drop new elements whose keys are already in *this.  Both sequences
+        // are sorted, so this is a single linear pass.
+        auto const old_size = keys_.size();
+        {
+            std::size_t i = 0;
+            auto const new_last = std::remove_if(
+                batch.begin(), batch.end(), [&](value_type const & x) {
+                    while (i < old_size && comp_(keys_[i], x.first)) {
+                        ++i;
+                    }
+                    return i < old_size && !comp_(x.first, keys_[i]);
+                });
+            batch.erase(new_last, batch.end());
+        }
+        if (batch.empty())
+            return;
+
+        // This requires Key and T to be default constructible, which is fine
+        // for an example.
+        keys_.resize(old_size + batch.size());
+        values_.resize(old_size + batch.size());
+        auto out = keys_.size();
+        auto old_i = old_size;
+        auto batch_i = batch.size();
+        while (batch_i) {
+            --out;
+            if (old_i && comp_(batch[batch_i - 1].first, keys_[old_i - 1])) {
+                --old_i;
+                keys_[out] = std::move(keys_[old_i]);
+                values_[out] = std::move(values_[old_i]);
+            } else {
+                --batch_i;
+                keys_[out] = std::move(batch[batch_i].first);
+                values_[out] = std::move(batch[batch_i].second);
+            }
+        }
+    }
+    void insert(std::initializer_list<value_type> il)
+    {
+        insert(il.begin(), il.end());
+    }
+
+    iterator erase(const_iterator f, const_iterator l)
+    {
+        auto const first = f.key_ptr() - keys_.data();
+        auto const last = l.key_ptr() - keys_.data();
+        keys_.erase(keys_.begin() + first, keys_.begin() + last);
+        values_.erase(values_.begin() + first, values_.begin() + last);
+        return begin() + first;
+    }
+    size_type erase(Key const & k)
+    {
+        auto const it = find(k);
+        if (it == end())
+            return 0;
+        erase(it, std::next(it));
+        return 1;
+    }
+    void swap(flat_map & other)
+    {
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(values_, other.values_);
+        swap(comp_, other.comp_);
+    }
+    void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+    }
+
+    key_compare key_comp() const { return comp_; }
+
+    iterator find(Key const & k)
+    {
+        auto const i = lower_bound_index(k);
+        return i != keys_.size() && !comp_(k, keys_[i]) ? begin() + i : end();
+    }
+    const_iterator find(Key const & k) const
+    {
+        return const_cast<flat_map &>(*this).find(k);
+    }
+    bool contains(Key const & k) const { return find(k) != this->end(); }
+    size_type count(Key const & k) const { return contains(k) ? 1 : 0; }
+    iterator lower_bound(Key const & k) { return begin() + lower_bound_index(k); }
+    const_iterator lower_bound(Key const & k) const
+    {
+        return this->begin() + lower_bound_index(k);
+    }
+    iterator upper_bound(Key const & k)
+    {
+        return begin() + (std::upper_bound(keys_.begin(), keys_.end(), k, comp_) -
+                          keys_.begin());
+    }
+    const_iterator upper_bound(Key const & k) const
+    {
+        return const_cast<flat_map &>(*this).upper_bound(k);
+    }
+
+    using base_type = boost::stl_interfaces::sequence_container_interface<
+        flat_map<Key, T, Compare>>;
+    using base_type::begin;
+    using base_type::end;
+    using base_type::erase;
+
+private:
+    std::size_t lower_bound_index(Key const & k) const
+    {
+        return std::lower_bound(keys_.begin(), keys_.end(), k, comp_) -
+               keys_.begin();
+    }
+
+    std::vector<Key> keys_;
+    std::vector<T> values_;
+    Compare comp_;
+};
+//]
+
+#endif
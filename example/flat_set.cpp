@@ -0,0 +1,51 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "flat_set.hpp"
+
+#include <cassert>
+
+
+int main()
+{
+    //[ flat_set_usage
+    flat_set<int> set = {5, 1, 3};
+    assert(set.size() == 3u);
+    assert(set.front() == 1);
+    assert(set.back() == 5);
+
+    assert(set.insert(3).second == false);
+    assert(set.insert(4).second == true);
+    assert(set == (flat_set<int>{1, 3, 4, 5}));
+
+    // One sort of the new elements, and one merge, no matter how many there
+    // are.  Duplicates, both within the batch and of existing keys, are
+    // dropped.
+    std::vector<int> const batch = {9, 0, 4, 7, 0, 2};
+    set.insert(batch.begin(), batch.end());
+    assert(set == (flat_set<int>{0, 1, 2, 3, 4, 5, 7, 9}));
+
+    // A batch that sorts entirely after the existing keys is just appended.
+    std::vector<int> const tail = {12, 10, 11};
+    set.insert(tail.begin(), tail.end());
+    assert(set == (flat_set<int>{0, 1, 2, 3, 4, 5, 7, 9, 10, 11, 12}));
+
+    assert(set.contains(7));
+    assert(!set.contains(8));
+    assert(*set.data() == 0);
+    assert(set.erase(7) == 1u);
+    assert(set.erase(8) == 0u);
+    set.erase(set.begin());
+    assert(set == (flat_set<int>{1, 2, 3, 4, 5, 9, 10, 11, 12}));
+    //]
+
+    {
+        flat_set<int, std::greater<int>> reversed = {1, 2, 3};
+        int const more[] = {0, 2, 4};
+        reversed.insert(std::begin(more), std::end(more));
+        assert(reversed == (flat_set<int, std::greater<int>>{4, 3, 2, 1, 0}));
+        assert(reversed.front() == 4);
+    }
+}
@@ -0,0 +1,195 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_EXAMPLE_FLAT_SET_HPP
+#define BOOST_STL_INTERFACES_EXAMPLE_FLAT_SET_HPP
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+
+//[ flat_set_defn
+// A sorted, unique-key set that keeps its keys in a single contiguous
+// std::vector.  Lookups are binary searches over contiguous memory, and there
+// is no per-element allocation.
+//
+// Since the elements are contiguous, we pass element_layout::contiguous, and
+// sequence_container_interface provides data() for us.  Note that the
+// iterators are both const; the keys are what keep the set sorted, so users
+// must not be able to write through them.
+template<typename Key, typename Compare = std::less<Key>>
+struct flat_set : boost::stl_interfaces::sequence_container_interface<
+                      flat_set<Key, Compare>,
+                      boost::stl_interfaces::element_layout::contiguous>
+{
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using reference = Key const &;
+    using const_reference = Key const &;
+    using pointer = Key const *;
+    using const_pointer = Key const *;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = Key const *;
+    using const_iterator = Key const *;
+    using reverse_iterator = boost::stl_interfaces::reverse_iterator<iterator>;
+    using const_reverse_iterator =
+        boost::stl_interfaces::reverse_iterator<const_iterator>;
+
+    // The std::vector member takes care of all the special members for us.
+    flat_set() = default;
+    explicit flat_set(Compare const & comp) : comp_(comp) {}
+    template<
+        typename InputIterator,
+        typename Enable = std::enable_if_t<std::is_convertible<
+            typename std::iterator_traits<InputIterator>::iterator_category,
+            std::input_iterator_tag>::value>>
+    flat_set(
+        InputIterator first,
+        InputIterator last,
+        Compare const & comp = Compare()) :
+        comp_(comp)
+    {
+        insert(first, last);
+    }
+    flat_set(std::initializer_list<Key> il, Compare const & comp = Compare()) :
+        flat_set(il.begin(), il.end(), comp)
+    {}
+
+    iterator begin() noexcept { return keys_.data(); }
+    iterator end() noexcept { return keys_.data() + keys_.size(); }
+
+    size_type max_size() const noexcept { return keys_.max_size(); }
+    size_type capacity() const noexcept { return keys_.capacity(); }
+    void reserve(size_type n) { keys_.reserve(n); }
+    void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args &&... args)
+    {
+        return insert(Key(std::forward<Args>(args)...));
+    }
+    std::pair<iterator, bool> insert(Key const & x) { return insert_impl(x); }
+    std::pair<iterator, bool> insert(Key && x)
+    {
+        return insert_impl(std::move(x));
+    }
+    iterator insert(const_iterator, Key const & x) { return insert(x).first; }
+    iterator insert(const_iterator, Key && x)
+    {
+        return insert(std::move(x)).first;
+    }
+
+    // This is the bulk-insertion path.  Instead of doing a binary search and
+    // a shift of the tail for each element (O(N*M) moves in total), we
+    // append the whole batch, sort just the new tail, and merge it into the
+    // existing keys in a single pass.  As with std::flat_set, existing keys
+    // win over new ones, since std::inplace_merge is stable.  Among new keys
+    // that are equivalent to each other, only one survives, and which one is
+    // unspecified, since std::sort is not stable.
+    template<
+        typename InputIterator,
+        typename Enable = std::enable_if_t<std::is_convertible<
+            typename std::iterator_traits<InputIterator>::iterator_category,
+            std::input_iterator_tag>::value>>
+    void insert(InputIterator first, InputIterator last)
+    {
+        auto const old_size = keys_.size();
+        keys_.insert(keys_.end(), first, last);
+        if (keys_.size() == old_size)
+            return;
+
+        auto const equiv = [this](Key const & lhs, Key const & rhs) {
+            return !comp_(lhs, rhs);
+        };
+        auto const mid = keys_.begin() + old_size;
+        std::sort(mid, keys_.end(), comp_);
+        keys_.erase(std::unique(mid, keys_.end(), equiv), keys_.end());
+
+        // Appending keys that all sort after the existing ones is common
+        // enough (e.g. rebuilding from sorted batches) to skip the merge.
+        if (old_size && !comp_(keys_[old_size - 1], keys_[old_size])) {
+            std::inplace_merge(keys_.begin(), mid, keys_.end(), comp_);
+            keys_.erase(
+                std::unique(keys_.begin(), keys_.end(), equiv), keys_.end());
+        }
+    }
+    void insert(std::initializer_list<Key> il) { insert(il.begin(), il.end()); }
+
+    iterator erase(const_iterator f, const_iterator l)
+    {
+        auto const first = keys_.begin() + (f - begin());
+        auto const last = keys_.begin() + (l - begin());
+        return begin() + (keys_.erase(first, last) - keys_.begin());
+    }
+    size_type erase(Key const & k)
+    {
+        auto const r = equal_range(k);
+        auto const retval = size_type(r.second - r.first);
+        erase(r.first, r.second);
+        return retval;
+    }
+    void swap(flat_set & other)
+    {
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(comp_, other.comp_);
+    }
+    void clear() noexcept { keys_.clear(); }
+
+    key_compare key_comp() const { return comp_; }
+    value_compare value_comp() const { return comp_; }
+
+    const_iterator find(Key const & k) const
+    {
+        auto const it = lower_bound(k);
+        return it != this->end() && !comp_(k, *it) ? it : this->end();
+    }
+    bool contains(Key const & k) const { return find(k) != this->end(); }
+    size_type count(Key const & k) const { return contains(k) ? 1 : 0; }
+    const_iterator lower_bound(Key const & k) const
+    {
+        return std::lower_bound(this->begin(), this->end(), k, comp_);
+    }
+    const_iterator upper_bound(Key const & k) const
+    {
+        return std::upper_bound(this->begin(), this->end(), k, comp_);
+    }
+    std::pair<const_iterator, const_iterator>
+    equal_range(Key const & k) const
+    {
+        return std::equal_range(this->begin(), this->end(), k, comp_);
+    }
+
+    using base_type = boost::stl_interfaces::sequence_container_interface<
+        flat_set<Key, Compare>,
+        boost::stl_interfaces::element_layout::contiguous>;
+    using base_type::begin;
+    using base_type::end;
+    using base_type::erase;
+
+private:
+    template<typename K>
+    std::pair<iterator, bool> insert_impl(K && x)
+    {
+        auto const it = std::lower_bound(keys_.begin(), keys_.end(), x, comp_);
+        if (it != keys_.end() && !comp_(x, *it))
+            return {begin() + (it - keys_.begin()), false};
+        auto const pos = keys_.insert(it, std::forward<K>(x));
+        return {begin() + (pos - keys_.begin()), true};
+    }
+
+    std::vector<Key> keys_;
+    Compare comp_;
+};
+//]
+
+#endif
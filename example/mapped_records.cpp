@@ -0,0 +1,108 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "mapped_records.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+
+//[ mapped_records_record
+struct trade
+{
+    std::uint64_t timestamp;
+    std::uint32_t symbol;
+    float price;
+};
+//]
+
+int main()
+{
+    char const * const path = "mapped_records_example.bin";
+    {
+        std::vector<trade> trades;
+        for (std::uint32_t i = 0; i < 100000; ++i) {
+            trades.push_back(trade{1000u + i, i % 50, 0.5f * i});
+        }
+        std::ofstream ofs(path, std::ios::binary);
+        ofs.write(
+            reinterpret_cast<char const *>(trades.data()),
+            trades.size() * sizeof(trade));
+    }
+
+    {
+        //[ mapped_records_usage
+        // Mapping the file is O(1); no records are read until they are used.
+        mapped_records<trade> const trades(
+            path, access_advice::sequential, 4096);
+
+        // These all come from view_interface.
+        assert(trades.size() == 100000);
+        assert(trades.front().timestamp == 1000u);
+        assert(trades.back().symbol == 99999u % 50);
+        assert(trades[7].price == 3.5f);
+        assert(trades.data() == trades.begin());
+
+        // Scan in windows, reading the next window ahead of time.
+        std::size_t const window = 4096;
+        std::ptrdiff_t n = 0;
+        for (auto first = trades.begin(); first != trades.end();) {
+            std::size_t const i = first - trades.begin();
+            trades.will_need(i + window, window);
+            auto const last = trades.end() - first < std::ptrdiff_t(window)
+                                  ? trades.end()
+                                  : first + window;
+            n += std::count_if(
+                first, last, [](trade const & t) { return t.symbol == 7u; });
+            first = last;
+        }
+        assert(n == 2000);
+        //]
+    }
+
+    {
+        mapped_records<trade> a(path);
+        mapped_records<trade> b = std::move(a);
+        assert(a.empty());
+        assert(b.size() == 100000);
+        a = std::move(b);
+        assert(a.size() == 100000);
+        assert(b.empty());
+        a.advise(access_advice::random);
+        assert(std::is_sorted(
+            a.begin(), a.end(), [](trade const & lhs, trade const & rhs) {
+                return lhs.timestamp < rhs.timestamp;
+            }));
+    }
+
+    {
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+        ofs.write("abc", 3);
+    }
+    {
+        bool threw = false;
+        try {
+            mapped_records<trade> bad(path);
+        } catch (std::system_error const &) {
+            threw = true;
+        }
+        assert(threw);
+    }
+
+    {
+        std::ofstream ofs(path, std::ios::binary | std::ios::trunc);
+    }
+    {
+        mapped_records<trade> const empty(path);
+        assert(empty.empty());
+        assert(empty.begin() == empty.end());
+    }
+
+    std::remove(path);
+}
@@ -0,0 +1,171 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_EXAMPLE_MAPPED_RECORDS_HPP
+#define BOOST_STL_INTERFACES_EXAMPLE_MAPPED_RECORDS_HPP
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace detail {
+    [[noreturn]] inline void throw_errno(int error = errno)
+    {
+        throw std::system_error(error, std::generic_category());
+    }
+
+    struct scoped_fd
+    {
+        ~scoped_fd()
+        {
+            if (0 <= fd)
+                ::close(fd);
+        }
+        int fd;
+    };
+}
+
+//[ mapped_records_defn
+// Hints about how a mapping will be accessed, passed on to madvise().
+enum class access_advice { normal, sequential, random, will_need };
+
+// A read-only view of a file of fixed-size, trivially copyable records.
+// Instead of read()ing the whole file into memory up front, we mmap() it, and
+// the kernel pages records in as they are first touched.
+//
+// This is a view in the sense that begin()/end() are cheap and it has no
+// container-like mutating members, but it does own its mapping, so it is
+// move-only, like std::ranges::owning_view.  Since the records are contiguous
+// in memory, we pass element_layout::contiguous, and view_interface provides
+// data(), size(), operator[](), front(), and back().
+template<typename T>
+struct mapped_records : boost::stl_interfaces::view_interface<
+                            mapped_records<T>,
+                            boost::stl_interfaces::element_layout::contiguous>
+{
+    static_assert(std::is_trivially_copyable<T>::value, "");
+
+    using size_type = std::size_t;
+
+    mapped_records() noexcept : addr_(nullptr), bytes_(0) {}
+
+    // Maps the file at path, applies advice to the whole mapping, and then
+    // asks the kernel to start reading in the first read_ahead records.
+    // Throws std::system_error on failure, including when the file size is
+    // not a multiple of sizeof(T).
+    explicit mapped_records(
+        char const * path,
+        access_advice advice = access_advice::normal,
+        size_type read_ahead = 0) :
+        addr_(nullptr), bytes_(0)
+    {
+        detail::scoped_fd const file = {::open(path, O_RDONLY | O_CLOEXEC)};
+        if (file.fd < 0)
+            detail::throw_errno();
+        struct stat info;
+        if (::fstat(file.fd, &info) < 0)
+            detail::throw_errno();
+        if (info.st_size % sizeof(T))
+            detail::throw_errno(EINVAL);
+        if (!info.st_size)
+            return;
+
+        // The mapping stays valid after file is closed.
+        void * const addr = ::mmap(
+            nullptr, size_type(info.st_size), PROT_READ, MAP_PRIVATE, file.fd, 0);
+        if (addr == MAP_FAILED)
+            detail::throw_errno();
+        addr_ = addr;
+        bytes_ = size_type(info.st_size);
+
+        advise(advice);
+        if (read_ahead)
+            will_need(0, read_ahead);
+    }
+
+    mapped_records(mapped_records && other) noexcept :
+        addr_(std::exchange(other.addr_, nullptr)),
+        bytes_(std::exchange(other.bytes_, 0))
+    {}
+    mapped_records & operator=(mapped_records && other) noexcept
+    {
+        mapped_records temp(std::move(other));
+        std::swap(addr_, temp.addr_);
+        std::swap(bytes_, temp.bytes_);
+        return *this;
+    }
+    ~mapped_records()
+    {
+        if (addr_)
+            ::munmap(addr_, bytes_);
+    }
+
+    T const * begin() const noexcept { return static_cast<T const *>(addr_); }
+    T const * end() const noexcept { return begin() + bytes_ / sizeof(T); }
+
+    // Changes the access advice for the whole mapping.  Like all the
+    // functions below, this is only a hint; failures are ignored.
+    void advise(access_advice advice) const noexcept
+    {
+        if (addr_)
+            ::madvise(addr_, bytes_, to_madv(advice));
+    }
+
+    // Asks the kernel to start reading records [first, first + n) in the
+    // background.  Calling this for the next window while processing the
+    // current one keeps a sequential scan from ever waiting on a page fault.
+    void will_need(size_type first, size_type n) const noexcept
+    {
+        madvise_records(first, n, MADV_WILLNEED);
+    }
+
+    // Tells the kernel that records [first, first + n) will not be needed
+    // again soon, so their pages may be reclaimed first.
+    void dont_need(size_type first, size_type n) const noexcept
+    {
+        madvise_records(first, n, MADV_DONTNEED);
+    }
+
+private:
+    static int to_madv(access_advice advice) noexcept
+    {
+        switch (advice) {
+        case access_advice::sequential: return MADV_SEQUENTIAL;
+        case access_advice::random: return MADV_RANDOM;
+        case access_advice::will_need: return MADV_WILLNEED;
+        default: return MADV_NORMAL;
+        }
+    }
+
+    // madvise() requires a page-aligned address, so the range is widened to
+    // the start of the page containing record first.
+    void madvise_records(size_type first, size_type n, int madv) const noexcept
+    {
+        size_type const count = bytes_ / sizeof(T);
+        if (count <= first || !n)
+            return;
+        if (count - first < n)
+            n = count - first;
+        size_type const page = size_type(::sysconf(_SC_PAGESIZE));
+        size_type const lo = first * sizeof(T) / page * page;
+        size_type const hi = (first + n) * sizeof(T);
+        ::madvise(static_cast<char *>(addr_) + lo, hi - lo, madv);
+    }
+
+    void * addr_;
+    size_type bytes_;
+};
+//]
+
+#endif
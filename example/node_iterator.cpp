@@ -3,7 +3,9 @@
 // Distributed under the Boost Software License, Version 1.0. (See
 // accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
-#include <boost/stl_interfaces/iterator_interface.hpp>
+#include "node_iterator.hpp"
+
+#include <boost/stl_interfaces/prefetch_iterator.hpp>
 
 #include <algorithm>
 #include <array>
@@ -12,65 +14,6 @@
 #include <cassert>
 
 
-//[ node_defn
-template<typename T>
-struct node
-{
-    T value_;
-    node * next_; // == nullptr in the tail node
-};
-//]
-
-//[ node_iterator_class_head
-template<typename T>
-struct node_iterator
-    : boost::stl_interfaces::iterator_interface<
-#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
-          node_iterator<T>,
-#endif
-          std::forward_iterator_tag, T>
-//]
-{
-    //[ node_iterator_ctors
-    constexpr node_iterator() noexcept : it_(nullptr) {}
-    constexpr node_iterator(node<T> * it) noexcept : it_(it) {}
-    //]
-
-    //[ node_iterator_user_ops
-    constexpr T & operator*() const noexcept { return it_->value_; }
-    constexpr node_iterator & operator++() noexcept
-    {
-        it_ = it_->next_;
-        return *this;
-    }
-    friend constexpr bool
-    operator==(node_iterator lhs, node_iterator rhs) noexcept
-    {
-        return lhs.it_ == rhs.it_;
-    }
-    //]
-
-    //[ node_iterator_using_declaration
-    using base_type = boost::stl_interfaces::iterator_interface<
-#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
-        node_iterator<T>,
-#endif
-        std::forward_iterator_tag, T>;
-    using base_type::operator++;
-    //]
-
-private:
-    node<T> * it_;
-};
-
-//[ node_iterator_concept_check Equivalent to
-// static_assert(std::forward_iterator<node_iterator>, ""), or nothing in
-// C++17 and earlier.
-BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT(
-    node_iterator<int>, std::forward_iterator)
-//]
-
-
 int main()
 {
     std::array<node<int>, 5> nodes;
@@ -93,4 +36,18 @@ int main()
     }
     std::cout << "\n";
     //]
+
+    //[ node_iterator_prefetch_usage
+    // Each increment also prefetches the node two positions ahead.
+    auto const prefetch_first =
+        boost::stl_interfaces::make_prefetch_iterator(first, last);
+    auto const prefetch_last =
+        boost::stl_interfaces::make_prefetch_iterator(last, last);
+    int sum = 0;
+    for (auto it = prefetch_first; it != prefetch_last; ++it) {
+        sum += *it;
+    }
+    assert(sum == 10);
+    //]
+    (void)sum;
 }
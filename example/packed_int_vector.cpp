@@ -0,0 +1,108 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "packed_int_vector.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+
+int main()
+{
+    //[ packed_int_vector_usage
+    // A million sorted timestamps, a few milliseconds apart.
+    packed_int_vector<std::int64_t> timestamps;
+    std::int64_t t = 1700000000000;
+    for (int i = 0; i < 1000000; ++i) {
+        t += 1 + i % 5;
+        timestamps.push_back(t);
+    }
+    assert(timestamps.size() == 1000000u);
+
+    // Each block of 128 needs at most 10 bits per element, instead of 64.
+    assert(timestamps.storage_bytes() * 5 < timestamps.size() * 8);
+
+    // Sequential scans decode each block once, on entry.
+    std::int64_t prev = 0;
+    for (auto x : timestamps) {
+        assert(prev < x);
+        prev = x;
+    }
+    assert(timestamps.back() == t);
+
+    // The iterators are random access, so binary search works too.
+    auto const it = std::lower_bound(
+        timestamps.begin(), timestamps.end(), std::int64_t(1700000001000));
+    assert(*it == 1700000001000);
+    assert(it - timestamps.begin() == 333);
+    //]
+
+    {
+        packed_int_vector<int> v = {-3, 7, 7, -100, 42};
+        assert(v.size() == 5u);
+        assert(v[3] == -100);
+        assert(v.front() == -3);
+        for (int i = 0; i < 500; ++i) {
+            v.push_back(i * (i % 2 ? -1 : 1));
+        }
+        assert(v.size() == 505u);
+        assert(v[5 + 301] == -301);
+        assert(v[5 + 400] == 400);
+        assert(
+            std::accumulate(v.begin(), v.end(), 0) ==
+            -3 + 7 + 7 - 100 + 42 - 250);
+        assert(*std::min_element(v.begin(), v.end()) == -499);
+        assert(*std::max_element(v.rbegin(), v.rend()) == 498);
+
+        // Appending to the block that was last read updates what is read.
+        assert(v.back() == -499);
+        v.push_back(7);
+        assert(v.back() == 7);
+
+        packed_int_vector<int> copy(v.begin(), v.end());
+        assert(copy == v);
+        copy.push_back(0);
+        assert(copy != v);
+        assert(v < copy);
+
+        copy.clear();
+        assert(copy.empty());
+
+        // A moved-from vector is empty, and can be reused.
+        packed_int_vector<int> moved(std::move(v));
+        assert(moved.size() == 506u);
+        assert(moved[5 + 400] == 400);
+        assert(v.empty());
+        assert(v.begin() == v.end());
+        v.push_back(3);
+        assert(v.size() == 1u && v[0] == 3 && v.back() == 3);
+
+        copy = {1, 2};
+        v = std::move(copy);
+        assert(copy.empty());
+        assert(v == packed_int_vector<int>({1, 2}));
+        v = std::move(moved);
+        assert(moved.empty());
+        assert(v.size() == 506u && v[5 + 301] == -301);
+    }
+
+    {
+        // Full-width deltas, and blocks with no deltas at all.
+        packed_int_vector<std::uint64_t> v;
+        for (int i = 0; i < 256; ++i) {
+            v.push_back(i % 2 ? ~std::uint64_t(0) : 0u);
+        }
+        for (int i = 0; i < 128; ++i) {
+            v.push_back(7u);
+        }
+        for (int i = 0; i < 256; ++i) {
+            assert(v[i] == (i % 2 ? ~std::uint64_t(0) : 0u));
+        }
+        assert(std::count(v.begin() + 256, v.end(), 7u) == 128);
+    }
+}
@@ -0,0 +1,287 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_EXAMPLE_PACKED_INT_VECTOR_HPP
+#define BOOST_STL_INTERFACES_EXAMPLE_PACKED_INT_VECTOR_HPP
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+
+template<typename T>
+struct packed_int_vector;
+
+//[ packed_int_iterator_defn
+// A random access iterator over a packed_int_vector.  Elements are stored in
+// compressed blocks, so there is nothing to return a reference to; this is a
+// proxy iterator whose reference type is T itself.
+//
+// Decoding one element at a time would mean redoing the shift-and-mask work
+// of locating it in its block on every dereference.  Instead, dereferencing
+// goes through packed_int_vector::element(), which decodes a whole block at
+// a time into a cache in the container, so later dereferences in that block
+// are plain array reads.
+//
+// The cache lives in the container rather than in the iterator, so that
+// copies of an iterator stay cheap, and still share it.  Standard algorithms
+// copy iterators freely (the comparison operators take them by value, for
+// instance), and operator[], reverse_iterator's operator*, and *it++ all
+// dereference a copy.
+template<typename T>
+struct packed_int_iterator : boost::stl_interfaces::proxy_iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                                 packed_int_iterator<T>,
+#endif
+                                 std::random_access_iterator_tag,
+                                 T>
+{
+    static constexpr std::ptrdiff_t block_size = 128;
+
+    packed_int_iterator() noexcept : v_(nullptr), pos_(0) {}
+    packed_int_iterator(
+        packed_int_vector<T> const * v, std::ptrdiff_t pos) noexcept :
+        v_(v), pos_(pos)
+    {}
+
+    T operator*() const { return v_->element(pos_); }
+    packed_int_iterator & operator+=(std::ptrdiff_t n) noexcept
+    {
+        pos_ += n;
+        return *this;
+    }
+    std::ptrdiff_t operator-(packed_int_iterator const & other) const noexcept
+    {
+        return pos_ - other.pos_;
+    }
+
+private:
+    packed_int_vector<T> const * v_;
+    std::ptrdiff_t pos_;
+};
+//]
+
+//[ packed_int_vector_defn
+// A read-optimized, append-only sequence of integers.  Elements are stored in
+// blocks of 128, using frame-of-reference encoding: each block stores its
+// minimum value, and then each element's difference from that minimum,
+// bit-packed using only as many bits as the largest difference needs.
+// Sorted sequences, and sequences of values in a small range (timestamps,
+// IDs, posting lists, etc.) compress very well this way.
+//
+// The final, partial block is kept uncompressed until it fills up.
+//
+// The most recently read block is kept decoded in a cache, which even const
+// reads update.  So, unlike a std::vector, a packed_int_vector cannot be
+// read from several threads at once without synchronization.
+template<typename T>
+struct packed_int_vector : boost::stl_interfaces::sequence_container_interface<
+                               packed_int_vector<T>>
+{
+    static_assert(std::is_integral<T>::value, "");
+
+    using value_type = T;
+    using reference = T;
+    using const_reference = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = packed_int_iterator<T>;
+    using const_iterator = packed_int_iterator<T>;
+    using reverse_iterator = boost::stl_interfaces::reverse_iterator<iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
+    static constexpr std::ptrdiff_t block_size = iterator::block_size;
+
+    packed_int_vector() noexcept : size_(0), cached_block_(-1) {}
+    template<
+        typename InputIterator,
+        typename Enable = std::enable_if_t<std::is_convertible<
+            typename std::iterator_traits<InputIterator>::iterator_category,
+            std::input_iterator_tag>::value>>
+    packed_int_vector(InputIterator first, InputIterator last) :
+        size_(0), cached_block_(-1)
+    {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+    packed_int_vector(std::initializer_list<T> il) :
+        packed_int_vector(il.begin(), il.end())
+    {}
+
+    packed_int_vector(packed_int_vector const &) = default;
+    packed_int_vector & operator=(packed_int_vector const &) = default;
+    // The defaulted moves would leave size_ behind in the moved-from vector,
+    // with its storage gone; these leave it empty instead.
+    packed_int_vector(packed_int_vector && other) noexcept :
+        blocks_(std::move(other.blocks_)),
+        words_(std::move(other.words_)),
+        tail_(std::move(other.tail_)),
+        size_(other.size_),
+        cached_block_(other.cached_block_),
+        cache_(other.cache_)
+    {
+        other.clear();
+    }
+    packed_int_vector & operator=(packed_int_vector && other) noexcept
+    {
+        packed_int_vector temp(std::move(other));
+        swap(temp);
+        return *this;
+    }
+
+    // Iterators refer to *this, so they are invalidated by copying or moving
+    // the container, just like std::vector's are by a copy.
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, difference_type(size_));
+    }
+
+    size_type max_size() const noexcept
+    {
+        return std::numeric_limits<difference_type>::max();
+    }
+
+    // The number of bytes used to store the elements.
+    size_type storage_bytes() const noexcept
+    {
+        return blocks_.size() * sizeof(block_header) +
+               words_.size() * sizeof(std::uint64_t) + tail_.size() * sizeof(T);
+    }
+
+    T emplace_back(T x)
+    {
+        // Only the tail block changes.  Any cached block at or past it is
+        // either the tail, or is left over from before a move or clear().
+        if (difference_type(blocks_.size()) <= cached_block_)
+            cached_block_ = -1;
+        tail_.push_back(x);
+        ++size_;
+        if (tail_.size() == size_type(block_size)) {
+            encode_block(tail_.data());
+            tail_.clear();
+        }
+        return x;
+    }
+
+    void swap(packed_int_vector & other)
+    {
+        std::swap(blocks_, other.blocks_);
+        std::swap(words_, other.words_);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+        std::swap(cached_block_, other.cached_block_);
+        std::swap(cache_, other.cache_);
+    }
+    void clear() noexcept
+    {
+        blocks_.clear();
+        words_.clear();
+        tail_.clear();
+        size_ = 0;
+        cached_block_ = -1;
+    }
+
+    // Writes all block_size elements of the given block to out.  Code that
+    // wants to scan blocks in bulk can use this directly.
+    void decode_block(std::ptrdiff_t block, T * out) const
+    {
+        if (block == difference_type(blocks_.size())) {
+            std::copy(tail_.begin(), tail_.end(), out);
+            return;
+        }
+        auto const & header = blocks_[block];
+        auto const reference = unsigned_type(header.reference);
+        auto const width = header.width;
+        if (!width) {
+            std::fill_n(out, block_size, header.reference);
+            return;
+        }
+        auto const mask = width == 64 ? ~std::uint64_t(0)
+                                      : (std::uint64_t(1) << width) - 1u;
+        std::uint64_t const * const words = words_.data() + header.offset;
+        for (std::ptrdiff_t i = 0; i < block_size; ++i) {
+            auto const bit = i * width;
+            auto const word = bit / 64;
+            auto const offset = bit % 64;
+            auto delta = words[word] >> offset;
+            if (64 < offset + width)
+                delta |= words[word + 1] << (64 - offset);
+            out[i] = T(unsigned_type(reference + (delta & mask)));
+        }
+    }
+
+private:
+    friend iterator;
+
+    using unsigned_type = std::make_unsigned_t<T>;
+
+    T element(difference_type pos) const
+    {
+        auto const block = pos / block_size;
+        if (block != cached_block_) {
+            decode_block(block, cache_.data());
+            cached_block_ = block;
+        }
+        return cache_[pos % block_size];
+    }
+
+    struct block_header
+    {
+        T reference;
+        std::uint32_t offset; // In words_.
+        std::uint8_t width;   // In bits.
+    };
+
+    void encode_block(T const * values)
+    {
+        auto const minmax = std::minmax_element(values, values + block_size);
+        auto const reference = unsigned_type(*minmax.first);
+        std::uint64_t const max_delta =
+            unsigned_type(unsigned_type(*minmax.second) - reference);
+        std::uint8_t width = 0;
+        for (auto d = max_delta; d; d >>= 1) {
+            ++width;
+        }
+
+        block_header const header = {
+            *minmax.first, std::uint32_t(words_.size()), width};
+        blocks_.push_back(header);
+        // block_size * width bits is exactly 2 * width words.
+        words_.resize(words_.size() + block_size * width / 64, 0u);
+        std::uint64_t * const words = words_.data() + header.offset;
+        for (std::ptrdiff_t i = 0; width && i < block_size; ++i) {
+            std::uint64_t const delta =
+                unsigned_type(unsigned_type(values[i]) - reference);
+            auto const bit = i * width;
+            auto const word = bit / 64;
+            auto const offset = bit % 64;
+            words[word] |= delta << offset;
+            if (64 < offset + width)
+                words[word + 1] |= delta >> (64 - offset);
+        }
+    }
+
+    std::vector<block_header> blocks_;
+    std::vector<std::uint64_t> words_;
+    std::vector<T> tail_;
+    size_type size_;
+    // There is one decoded block for the whole container, shared by all its
+    // iterators.  When two iterators in different blocks are dereferenced
+    // in turn, as in std::equal(v.begin(), v.end() - 128, v.begin() + 128),
+    // every dereference decodes a whole block again.  Such loops are better
+    // written over blocks, using decode_block().
+    mutable difference_type cached_block_;
+    mutable std::array<T, block_size> cache_;
+};
+//]
+
+#endif
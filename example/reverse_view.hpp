@@ -19,7 +19,8 @@ namespace detail {
         template<typename V>
         static auto call(V const & v)
         {
-            return boost::stl_interfaces::make_reverse_iterator(v.end());
+            return boost::stl_interfaces::reverse_iterator<
+                decltype(v.end())>(v.end());
         }
     };
 
@@ -34,7 +35,7 @@ namespace detail {
             while (v_f != v_l) {
                 ++v_f;
             }
-            return boost::stl_interfaces::make_reverse_iterator(v_f);
+            return boost::stl_interfaces::reverse_iterator<decltype(v_f)>(v_f);
         }
     };
 
@@ -89,7 +90,7 @@ namespace detail {
         constexpr iterator begin() const { return first_; }
         constexpr iterator end() const
         {
-            return boost::stl_interfaces::make_reverse_iterator(v_.begin());
+            return iterator(v_.begin());
         }
 
         // Return the underlying view that this view reverses.
@@ -3,6 +3,7 @@
 // Distributed under the Boost Software License, Version 1.0. (See
 // accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
 #include <boost/stl_interfaces/sequence_container_interface.hpp>
 
 #include <algorithm>
@@ -140,7 +141,20 @@ struct static_vector : sequence_container_interface<
     {
         resize_impl(sz, [&]() -> T const & { return x; });
     }
-    void reserve(size_type n) noexcept { assert(n < capacity()); }
+    // Not part of the std::vector interface.  New elements are
+    // default-initialized, so for trivial types like char they are left
+    // uninitialized, for the caller to overwrite.
+    void resize_for_overwrite(size_type sz) noexcept
+    {
+        assert(sz <= capacity());
+        if (sz < this->size())
+            erase(begin() + sz, end());
+        for (auto it = end(), last = begin() + sz; it != last; ++it) {
+            new (static_cast<void *>(std::addressof(*it))) T;
+        }
+        size_ = sz;
+    }
+    void reserve(size_type n) noexcept { assert(n <= capacity()); }
     void shrink_to_fit() noexcept {}
 
     // element access (skipped 8)
@@ -187,6 +201,13 @@ struct static_vector : sequence_container_interface<
     }
     // Note: The iterator category here was upgraded to ForwardIterator
     // (instead of vector's InputIterator), to ensure linear time complexity.
+    // sequence_container_interface handles true input iterators, by
+    // appending them with emplace_back() and rotating them into place.
+    //
+    // The copies go through boost::stl_interfaces::copy() and
+    // uninitialized_copy(), so insert(pos, n, x) and assign(n, x), which
+    // sequence_container_interface implements with repeat_iterators, become
+    // fills.
     template<
         typename ForwardIterator,
         typename Enable = std::enable_if_t<std::is_convertible<
@@ -197,10 +218,15 @@ struct static_vector : sequence_container_interface<
     {
         auto position = const_cast<T *>(pos);
         auto const insertions = std::distance(first, last);
-        assert(this->size() + insertions < capacity());
-        uninitialized_generate(end(), end() + insertions, [] { return T(); });
-        std::move_backward(position, end(), end() + insertions);
-        std::copy(first, last, position);
+        assert(this->size() + insertions <= capacity());
+        if (position == end()) {
+            boost::stl_interfaces::uninitialized_copy(first, last, end());
+        } else {
+            uninitialized_generate(
+                end(), end() + insertions, [] { return T(); });
+            std::move_backward(position, end(), end() + insertions);
+            boost::stl_interfaces::copy(first, last, position);
+        }
         size_ += insertions;
         return position;
     }
@@ -268,7 +294,7 @@ private:
     template<typename F>
     void resize_impl(size_type sz, F func) noexcept
     {
-        assert(sz < capacity());
+        assert(sz <= capacity());
         if (sz < this->size())
             erase(begin() + sz, end());
         if (this->size() < sz)
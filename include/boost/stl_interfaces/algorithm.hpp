@@ -0,0 +1,608 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_ALGORITHM_HPP
+#define BOOST_STL_INTERFACES_ALGORITHM_HPP
+
+#include <boost/stl_interfaces/detail/algorithm_traits.hpp>
+#include <boost/stl_interfaces/generating_iterators.hpp>
+#include <boost/stl_interfaces/remove.hpp>
+#include <boost/stl_interfaces/reverse_iterator.hpp>
+
+#include <boost/type_traits/is_detected.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+
+namespace boost { namespace stl_interfaces {
+    namespace detail {
+        template<typename Out, typename T>
+        using write_n_expr = decltype(std::declval<Out &>().write_n(
+            std::declval<T const *>(), std::size_t(0)));
+        template<typename Out>
+        using reserve_hint_expr =
+            decltype(std::declval<Out &>().reserve_hint(std::size_t(0)));
+        template<typename Iter>
+        using iter_sub_expr = decltype(
+            std::declval<Iter const &>() - std::declval<Iter const &>());
+
+        // 2: write_n(), 1: reserve_hint() and then one element at a time,
+        // 0: one element at a time.
+        template<int N>
+        using bulk_strategy = std::integral_constant<int, N>;
+
+        template<typename Iter, typename Out, bool Sized>
+        using copy_strategy = bulk_strategy<
+            contiguous_iter_v<Iter> &&
+                    is_detected_v<write_n_expr, Out, iter_value_t<Iter>>
+                ? 2
+                : Sized && is_detected_v<reserve_hint_expr, Out> ? 1 : 0>;
+
+        template<typename Iter, typename Out>
+        constexpr Out copy_loop(Iter first, Iter last, Out out)
+        {
+            for (; first != last; ++first, (void)++out) {
+                *out = *first;
+            }
+            return out;
+        }
+
+        template<typename Iter, typename Out>
+        constexpr Out
+        copy_impl(Iter first, Iter last, Out out, bulk_strategy<0>)
+        {
+            return detail::copy_loop(first, last, out);
+        }
+        template<typename Iter, typename Out>
+        constexpr Out
+        copy_impl(Iter first, Iter last, Out out, bulk_strategy<1>)
+        {
+            out.reserve_hint(std::size_t(last - first));
+            return detail::copy_loop(first, last, out);
+        }
+        template<typename Iter, typename Out>
+        constexpr Out
+        copy_impl(Iter first, Iter last, Out out, bulk_strategy<2>)
+        {
+            if (first != last)
+                out.write_n(
+                    detail::to_pointer(first), std::size_t(last - first));
+            return out;
+        }
+
+        template<typename Iter, typename Size, typename Out>
+        constexpr Out copy_n_loop(Iter first, Size n, Out out)
+        {
+            for (; 0 < n; ++first, (void)++out, --n) {
+                *out = *first;
+            }
+            return out;
+        }
+
+        template<typename Iter, typename Size, typename Out>
+        constexpr Out
+        copy_n_impl(Iter first, Size n, Out out, bulk_strategy<0>)
+        {
+            return detail::copy_n_loop(first, n, out);
+        }
+        template<typename Iter, typename Size, typename Out>
+        constexpr Out
+        copy_n_impl(Iter first, Size n, Out out, bulk_strategy<1>)
+        {
+            if (0 < n)
+                out.reserve_hint(std::size_t(n));
+            return detail::copy_n_loop(first, n, out);
+        }
+        template<typename Iter, typename Size, typename Out>
+        constexpr Out
+        copy_n_impl(Iter first, Size n, Out out, bulk_strategy<2>)
+        {
+            if (0 < n)
+                out.write_n(detail::to_pointer(first), std::size_t(n));
+            return out;
+        }
+
+        template<typename Iter, typename Out, typename F>
+        constexpr Out transform_loop(Iter first, Iter last, Out out, F & f)
+        {
+            for (; first != last; ++first, (void)++out) {
+                *out = f(*first);
+            }
+            return out;
+        }
+
+        template<typename Iter, typename Out, typename F>
+        constexpr Out
+        transform_impl(Iter first, Iter last, Out out, F & f, std::false_type)
+        {
+            return detail::transform_loop(first, last, out, f);
+        }
+        template<typename Iter, typename Out, typename F>
+        constexpr Out
+        transform_impl(Iter first, Iter last, Out out, F & f, std::true_type)
+        {
+            out.reserve_hint(std::size_t(last - first));
+            return detail::transform_loop(first, last, out, f);
+        }
+
+        // A reverse iterator over a pointer is just as contiguous as the
+        // pointer; the standard algorithms simply fail to notice.  The
+        // overloads below take the base() pointers back out, so that the
+        // standard library's memmove()/memcmp() paths, or memrchr(), apply.
+        template<typename Iter>
+        struct reversed_pointer : std::false_type
+        {};
+        template<typename T>
+        struct reversed_pointer<std::reverse_iterator<T *>> : std::true_type
+        {};
+        template<typename T>
+        struct reversed_pointer<v1::reverse_iterator<T *>> : std::true_type
+        {};
+
+        // 2: reversed pointer to reversed pointer, 1: reversed pointer to
+        // pointer, 0: anything else.
+        template<typename Iter, typename Out>
+        using reverse_copy_strategy = std::integral_constant<
+            int,
+            !reversed_pointer<Iter>::value ? 0
+            : reversed_pointer<Out>::value ? 2
+            : std::is_pointer<Out>::value  ? 1
+                                           : 0>;
+
+        template<typename Iter, typename Out>
+        constexpr Out
+        reverse_copy_impl(Iter first, Iter last, Out out, bulk_strategy<0>)
+        {
+            return detail::copy_impl(
+                first,
+                last,
+                out,
+                copy_strategy<Iter, Out, is_detected_v<iter_sub_expr, Iter>>{});
+        }
+        template<typename Iter, typename Out>
+        Out reverse_copy_impl(Iter first, Iter last, Out out, bulk_strategy<1>)
+        {
+            return std::reverse_copy(last.base(), first.base(), out);
+        }
+        // Writing through a reversed output pointer fills memory back to
+        // front, which is exactly what std::copy_backward() does.
+        template<typename Iter, typename Out>
+        Out reverse_copy_impl(Iter first, Iter last, Out out, bulk_strategy<2>)
+        {
+            return Out(
+                std::copy_backward(last.base(), first.base(), out.base()));
+        }
+
+        // Copying from a repeat_iterator is a fill, and copying from an
+        // iota_iterator is a loop that is simple enough to vectorize; both
+        // need a contiguous destination to do better than the element-wise
+        // loop.
+        template<typename Iter>
+        struct generated_iter : std::integral_constant<int, 0>
+        {};
+        template<typename T>
+        struct generated_iter<repeat_iterator<T>>
+            : std::integral_constant<int, 1>
+        {};
+        template<typename T>
+        struct generated_iter<iota_iterator<T>> : std::integral_constant<int, 2>
+        {};
+
+        // 2: iota to contiguous, 1: repeat to contiguous, 0: anything else.
+        template<typename Iter, typename Out>
+        using generated_copy_strategy = bulk_strategy<
+            contiguous_iter_v<Out> ? generated_iter<Iter>::value : 0>;
+
+        template<typename Iter, typename Out>
+        constexpr Out
+        generated_copy_impl(Iter first, Iter last, Out out, bulk_strategy<0>)
+        {
+            return detail::reverse_copy_impl(
+                first, last, out, reverse_copy_strategy<Iter, Out>{});
+        }
+        template<typename Iter, typename Out>
+        Out
+        generated_copy_impl(Iter first, Iter last, Out out, bulk_strategy<1>)
+        {
+            if (first == last)
+                return out;
+            auto const n = last - first;
+            std::fill_n(detail::to_pointer(out), n, *first);
+            return out + n;
+        }
+        template<typename Iter, typename Out>
+        constexpr Out
+        generated_copy_impl(Iter first, Iter last, Out out, bulk_strategy<2>)
+        {
+            auto const x = *first;
+            auto const n = last - first;
+            auto const p = detail::to_pointer(out);
+            for (std::ptrdiff_t i = 0; i < n; ++i) {
+                p[i] = decltype(x)(x + i);
+            }
+            return out + n;
+        }
+
+        template<typename Iter, typename Size, typename Out>
+        constexpr Out
+        generated_copy_n_impl(Iter first, Size n, Out out, bulk_strategy<0>)
+        {
+            return detail::copy_n_impl(
+                first, n, out, copy_strategy<Iter, Out, true>{});
+        }
+        template<typename Iter, typename Size, typename Out, int N>
+        constexpr Out
+        generated_copy_n_impl(Iter first, Size n, Out out, bulk_strategy<N>)
+        {
+            if (n <= 0)
+                return out;
+            return detail::generated_copy_impl(
+                first, first + n, out, bulk_strategy<N>{});
+        }
+
+        template<typename Iter, typename Out>
+        Out uninitialized_copy_impl(
+            Iter first, Iter last, Out out, std::false_type)
+        {
+            return std::uninitialized_copy(first, last, out);
+        }
+        template<typename Iter, typename Out>
+        Out uninitialized_copy_impl(
+            Iter first, Iter last, Out out, std::true_type)
+        {
+            if (first == last)
+                return out;
+            return std::uninitialized_fill_n(out, last - first, *first);
+        }
+
+        struct copy_fn
+        {
+            template<typename InputIterator, typename OutputIterator>
+            constexpr OutputIterator operator()(
+                InputIterator first,
+                InputIterator last,
+                OutputIterator out) const
+            {
+                return detail::generated_copy_impl(
+                    first,
+                    last,
+                    out,
+                    generated_copy_strategy<InputIterator, OutputIterator>{});
+            }
+        };
+
+        template<typename T>
+        using byte_sized = std::integral_constant<
+            bool,
+            std::is_integral<T>::value && sizeof(T) == 1 &&
+                !std::is_same<T, bool>::value>;
+
+        // 3: reversed pointer to bytes, 2: pointer to bytes, 1: reversed
+        // pointer, 0: anything else.  The byte cases require that T is the
+        // element type, since find() compares after promotion, and
+        // memchr() does not.
+        template<
+            typename Iter,
+            typename T,
+            typename Element = iter_value_t<Iter>>
+        using find_strategy = std::integral_constant<
+            int,
+            reversed_pointer<Iter>::value
+                ? (byte_sized<Element>::value && std::is_same<Element, T>::value
+                       ? 3
+                       : 1)
+            : std::is_pointer<Iter>::value && byte_sized<Element>::value &&
+                    std::is_same<Element, T>::value
+                ? 2
+                : 0>;
+
+        template<typename Iter, typename T>
+        constexpr Iter
+        find_impl(Iter first, Iter last, T const & x, bulk_strategy<0>)
+        {
+            for (; first != last; ++first) {
+                if (*first == x)
+                    break;
+            }
+            return first;
+        }
+        template<typename Iter, typename T>
+        Iter find_impl(Iter first, Iter last, T const & x, bulk_strategy<1>)
+        {
+            auto const base_first = last.base();
+            auto it = first.base();
+            while (it != base_first) {
+                --it;
+                if (*it == x)
+                    return Iter(it + 1);
+            }
+            return last;
+        }
+        template<typename Iter, typename T>
+        Iter find_impl(Iter first, Iter last, T const & x, bulk_strategy<2>)
+        {
+            if (first == last)
+                return last;
+            auto const p = std::memchr(
+                first,
+                static_cast<unsigned char>(x),
+                std::size_t(last - first));
+            return p ? first + (static_cast<char const *>(p) -
+                                reinterpret_cast<char const *>(first))
+                     : last;
+        }
+        template<typename Iter, typename T>
+        Iter find_impl(Iter first, Iter last, T const & x, bulk_strategy<3>)
+        {
+#if defined(__GLIBC__) && defined(_GNU_SOURCE)
+            auto const base_first = last.base();
+            auto const n = std::size_t(first.base() - base_first);
+            if (!n)
+                return last;
+            auto const p =
+                ::memrchr(base_first, static_cast<unsigned char>(x), n);
+            return p ? Iter(
+                           base_first +
+                           (static_cast<char const *>(p) -
+                            reinterpret_cast<char const *>(base_first)) +
+                           1)
+                     : last;
+#else
+            return detail::find_impl(first, last, x, bulk_strategy<1>{});
+#endif
+        }
+
+        struct find_fn
+        {
+            template<typename InputIterator, typename T>
+            constexpr InputIterator operator()(
+                InputIterator first, InputIterator last, T const & x) const
+            {
+                return detail::find_impl(
+                    first, last, x, find_strategy<InputIterator, T>{});
+            }
+        };
+
+        // 2: two pointers, 1: two reversed pointers, 0: anything else.
+        template<typename Iter1, typename Iter2>
+        using equal_strategy = std::integral_constant<
+            int,
+            std::is_pointer<Iter1>::value && std::is_pointer<Iter2>::value ? 2
+            : reversed_pointer<Iter1>::value && reversed_pointer<Iter2>::value
+                ? 1
+                : 0>;
+
+        template<typename Iter1, typename Iter2>
+        constexpr bool
+        equal_impl(Iter1 first1, Iter1 last1, Iter2 first2, bulk_strategy<0>)
+        {
+            for (; first1 != last1; ++first1, (void)++first2) {
+                if (!(*first1 == *first2))
+                    return false;
+            }
+            return true;
+        }
+        template<typename Iter1, typename Iter2>
+        bool
+        equal_impl(Iter1 first1, Iter1 last1, Iter2 first2, bulk_strategy<1>)
+        {
+            auto const n = first1.base() - last1.base();
+            return std::equal(last1.base(), first1.base(), first2.base() - n);
+        }
+        template<typename Iter1, typename Iter2>
+        bool
+        equal_impl(Iter1 first1, Iter1 last1, Iter2 first2, bulk_strategy<2>)
+        {
+            return std::equal(first1, last1, first2);
+        }
+
+        template<typename Iter1, typename Iter2>
+        constexpr bool equal_impl(
+            Iter1 first1,
+            Iter1 last1,
+            Iter2 first2,
+            Iter2 last2,
+            std::false_type)
+        {
+            for (; first1 != last1 && first2 != last2;
+                 ++first1, (void)++first2) {
+                if (!(*first1 == *first2))
+                    return false;
+            }
+            return first1 == last1 && first2 == last2;
+        }
+        template<typename Iter1, typename Iter2>
+        constexpr bool equal_impl(
+            Iter1 first1,
+            Iter1 last1,
+            Iter2 first2,
+            Iter2 last2,
+            std::true_type)
+        {
+            if (last1 - first1 != last2 - first2)
+                return false;
+            return detail::equal_impl(
+                first1, last1, first2, equal_strategy<Iter1, Iter2>{});
+        }
+
+        struct equal_fn
+        {
+            template<typename InputIterator1, typename InputIterator2>
+            constexpr bool operator()(
+                InputIterator1 first1,
+                InputIterator1 last1,
+                InputIterator2 first2) const
+            {
+                return detail::equal_impl(
+                    first1,
+                    last1,
+                    first2,
+                    equal_strategy<InputIterator1, InputIterator2>{});
+            }
+            template<typename InputIterator1, typename InputIterator2>
+            constexpr bool operator()(
+                InputIterator1 first1,
+                InputIterator1 last1,
+                InputIterator2 first2,
+                InputIterator2 last2) const
+            {
+                return detail::equal_impl(
+                    first1,
+                    last1,
+                    first2,
+                    last2,
+                    std::integral_constant<
+                        bool,
+                        is_detected_v<iter_sub_expr, InputIterator1> &&
+                            is_detected_v<iter_sub_expr, InputIterator2>>{});
+            }
+        };
+
+        struct copy_n_fn
+        {
+            template<
+                typename InputIterator,
+                typename Size,
+                typename OutputIterator>
+            constexpr OutputIterator
+            operator()(InputIterator first, Size n, OutputIterator out) const
+            {
+                return detail::generated_copy_n_impl(
+                    first,
+                    n,
+                    out,
+                    generated_copy_strategy<InputIterator, OutputIterator>{});
+            }
+        };
+
+        struct uninitialized_copy_fn
+        {
+            template<typename InputIterator, typename ForwardIterator>
+            ForwardIterator operator()(
+                InputIterator first,
+                InputIterator last,
+                ForwardIterator out) const
+            {
+                return detail::uninitialized_copy_impl(
+                    first,
+                    last,
+                    out,
+                    std::integral_constant<
+                        bool,
+                        generated_iter<InputIterator>::value == 1>{});
+            }
+        };
+
+        struct transform_fn
+        {
+            template<
+                typename InputIterator,
+                typename OutputIterator,
+                typename UnaryOperation>
+            constexpr OutputIterator operator()(
+                InputIterator first,
+                InputIterator last,
+                OutputIterator out,
+                UnaryOperation f) const
+            {
+                return detail::transform_impl(
+                    first,
+                    last,
+                    out,
+                    f,
+                    std::integral_constant<
+                        bool,
+                        is_detected_v<iter_sub_expr, InputIterator> &&
+                            is_detected_v<
+                                reserve_hint_expr,
+                                OutputIterator>>{});
+            }
+        };
+
+    }
+
+    // These are function objects rather than function templates, so that
+    // they are never found by ADL; unqualified calls to copy() and friends
+    // keep finding the std versions.
+
+#if defined(__cpp_inline_variables) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+    /** Copies `[first, last)` to `out`, like `std::copy()`, but makes use of
+        the bulk-write members of `out`, if it has any.
+
+        An output iterator may opt in to bulk writes by providing one or both
+        of these members:
+
+        - `write_n(T const * p, std::size_t n)`, which must have the same
+          effect as `n` assignments from `p[0]` through `p[n - 1]`, each
+          followed by an increment; and
+
+        - `reserve_hint(std::size_t n)`, which is a hint that `n` elements
+          are about to be written, such as a `reserve()` on an underlying
+          container.
+
+        If `first` is a contiguous iterator and `out` has a `write_n()`
+        member, it is called once for the whole range.  Otherwise, if `last -
+        first` is well-formed and `out` has a `reserve_hint()` member, it is
+        called once before the elements are copied one at a time.
+
+        Copies from a reverse iterator over a pointer, to a pointer or to
+        another such reverse iterator, are done on the underlying pointers,
+        so that they get the same `memmove()`-based fast paths that the
+        standard library gives forward copies.
+
+        Copies to a contiguous iterator from a `repeat_iterator` are done
+        with `std::fill_n()`, and copies from an `iota_iterator` with a
+        single indexed loop. */
+    inline constexpr detail::copy_fn copy{};
+
+    /** Copies `[first, first + n)` to `out`, like `std::copy_n()`, using
+        the same fast paths as `copy()`. */
+    inline constexpr detail::copy_n_fn copy_n{};
+
+    /** Copy-constructs the elements of `[first, last)` into the
+        uninitialized memory starting at `out`, like
+        `std::uninitialized_copy()`.  Copies from a `repeat_iterator` are
+        done with `std::uninitialized_fill_n()`. */
+    inline constexpr detail::uninitialized_copy_fn uninitialized_copy{};
+
+    /** Writes `f(x)` to `out` for each `x` in `[first, last)`, like
+        `std::transform()`.  If `last - first` is well-formed and `out` has a
+        `reserve_hint()` member, it is called once before any elements are
+        written. */
+    inline constexpr detail::transform_fn transform{};
+
+    /** Returns the first iterator `it` in `[first, last)` for which `*it ==
+        x`, or `last` if there is none, like `std::find()`.  When the
+        iterators are pointers or reverse iterators over pointers to
+        byte-sized integers, and `x` has the same type as the elements, the
+        search is done with `memchr()` (or `memrchr()`, where available). */
+    inline constexpr detail::find_fn find{};
+
+    /** Returns whether `[first1, last1)` is equal to the range starting at
+        `first2` (or to `[first2, last2)`), like `std::equal()`.  When both
+        ranges are reverse iterators over pointers, the comparison is done on
+        the underlying pointers, so that the standard library's
+        `memcmp()`-based fast paths apply. */
+    inline constexpr detail::equal_fn equal{};
+
+#else
+    namespace {
+        constexpr detail::copy_fn copy{};
+        constexpr detail::copy_n_fn copy_n{};
+        constexpr detail::uninitialized_copy_fn uninitialized_copy{};
+        constexpr detail::transform_fn transform{};
+        constexpr detail::find_fn find{};
+        constexpr detail::equal_fn equal{};
+    }
+#endif
+
+}}
+
+#endif
@@ -31,6 +31,18 @@
 #define BOOST_STL_INTERFACES_USE_DEDUCED_THIS 0
 #endif
 
+// The interface templates are made of many small functions that only forward
+// to the derived type, or to each other.  These are annotated with
+// BOOST_STL_INTERFACES_FORCEINLINE, so that they are inlined even in
+// unoptimized builds, where they would otherwise each be a real call.  Define
+// BOOST_STL_INTERFACES_DISABLE_FORCEINLINE to leave inlining to the compiler.
+#if defined(BOOST_STL_INTERFACES_DISABLE_FORCEINLINE) ||                       \
+    defined(BOOST_STL_INTERFACES_DOXYGEN)
+#define BOOST_STL_INTERFACES_FORCEINLINE inline
+#else
+#define BOOST_STL_INTERFACES_FORCEINLINE BOOST_FORCEINLINE
+#endif
+
 // The inline namespaces v1, v2, and v3 represent C++14, C++20, and C++23 and
 // later, respectively.  v1 is inline for standards before C++20, and v2 is
 // inline for C++20 and later.  Note that this only applies to code for which
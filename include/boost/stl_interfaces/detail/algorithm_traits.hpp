@@ -0,0 +1,42 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_DETAIL_ALGORITHM_TRAITS_HPP
+#define BOOST_STL_INTERFACES_DETAIL_ALGORITHM_TRAITS_HPP
+
+#include <boost/stl_interfaces/config.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces { namespace detail {
+
+    template<typename Iter>
+    using iter_value_t = std::remove_cv_t<
+        std::remove_reference_t<decltype(*std::declval<Iter &>())>>;
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<typename Iter>
+    constexpr bool contiguous_iter_v = std::contiguous_iterator<Iter>;
+    template<typename Iter>
+    constexpr auto to_pointer(Iter it)
+    {
+        return std::to_address(it);
+    }
+#else
+    template<typename Iter>
+    constexpr bool contiguous_iter_v = std::is_pointer<Iter>::value;
+    template<typename T>
+    constexpr T * to_pointer(T * it)
+    {
+        return it;
+    }
+#endif
+
+}}}
+
+#endif
@@ -0,0 +1,100 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_GENERATING_ITERATORS_HPP
+#define BOOST_STL_INTERFACES_GENERATING_ITERATORS_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+namespace boost { namespace stl_interfaces {
+
+    /** A random access iterator over `n` copies of one value.  Iterating
+        over `[repeat_iterator(x, 0), repeat_iterator(x, n))` gives `n`
+        references to `x`.
+
+        `sequence_container_interface` passes a pair of these to the
+        user-defined `insert(pos, first, last)` to implement `insert(pos, n,
+        x)` and `assign(n, x)`, and `copy()` and `uninitialized_copy()` from
+        `<boost/stl_interfaces/algorithm.hpp>` turn copying from them into a
+        fill.  So a container whose `insert()` copies through those
+        algorithms gets `std::fill_n()` (and `memset()` for bytes) for
+        free. */
+    template<typename T>
+    struct repeat_iterator : iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                                 repeat_iterator<T>,
+#endif
+                                 std::random_access_iterator_tag,
+                                 T,
+                                 T const &,
+                                 T const *,
+                                 std::ptrdiff_t>
+    {
+        constexpr repeat_iterator() noexcept : x_(nullptr), n_(0) {}
+        constexpr repeat_iterator(T const & x, std::ptrdiff_t n) noexcept :
+            x_(std::addressof(x)), n_(n)
+        {}
+
+        constexpr T const & operator*() const noexcept { return *x_; }
+        constexpr repeat_iterator & operator+=(std::ptrdiff_t i) noexcept
+        {
+            n_ += i;
+            return *this;
+        }
+        constexpr std::ptrdiff_t operator-(repeat_iterator other) const
+            noexcept
+        {
+            return n_ - other.n_;
+        }
+
+    private:
+        T const * x_;
+        std::ptrdiff_t n_;
+    };
+
+    /** A random access iterator over consecutive values of an integral type
+        `T`. */
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<std::integral T>
+#else
+    template<
+        typename T,
+        typename Enable = std::enable_if_t<std::is_integral<T>::value>>
+#endif
+    struct iota_iterator : proxy_iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                               iota_iterator<T>,
+#endif
+                               std::random_access_iterator_tag,
+                               T,
+                               T,
+                               std::ptrdiff_t>
+    {
+        constexpr iota_iterator() noexcept : x_(0) {}
+        constexpr explicit iota_iterator(T x) noexcept : x_(x) {}
+
+        constexpr T operator*() const noexcept { return x_; }
+        constexpr iota_iterator & operator+=(std::ptrdiff_t i) noexcept
+        {
+            x_ = T(x_ + i);
+            return *this;
+        }
+        constexpr std::ptrdiff_t operator-(iota_iterator other) const noexcept
+        {
+            return std::ptrdiff_t(x_) - std::ptrdiff_t(other.x_);
+        }
+
+    private:
+        T x_;
+    };
+
+}}
+
+#endif
@@ -0,0 +1,202 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_HASH_HPP
+#define BOOST_STL_INTERFACES_HASH_HPP
+
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <boost/type_traits/is_detected.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+
+namespace boost { namespace stl_interfaces {
+
+    namespace detail {
+        inline std::uint64_t hash_mix(std::uint64_t x) noexcept
+        {
+            x ^= x >> 32;
+            x *= 0xd6e8feb86659fd93ull;
+            x ^= x >> 32;
+            x *= 0xd6e8feb86659fd93ull;
+            x ^= x >> 32;
+            return x;
+        }
+
+        // Hashes n bytes eight at a time.  This is not a cryptographic
+        // hash; it only needs to spread small keys, like short vectors of
+        // IDs, well enough for a hash table.
+        inline std::size_t hash_bytes(void const * p, std::size_t n) noexcept
+        {
+            auto bytes = static_cast<unsigned char const *>(p);
+            std::uint64_t h = 0x9e3779b97f4a7c15ull ^ n;
+            for (; 8 <= n; n -= 8, bytes += 8) {
+                std::uint64_t word;
+                std::memcpy(&word, bytes, 8);
+                h = hash_mix(h ^ word) + 0x9e3779b97f4a7c15ull;
+            }
+            if (n) {
+                std::uint64_t word = 0;
+                std::memcpy(&word, bytes, n);
+                h = hash_mix(h ^ word);
+            }
+            return std::size_t(hash_mix(h));
+        }
+
+        // Elements whose equal values always have the same bytes can be
+        // hashed as bytes.
+#if defined(__cpp_lib_has_unique_object_representations)
+        template<typename T>
+        using uniquely_represented =
+            std::has_unique_object_representations<T>;
+#else
+        template<typename T>
+        using uniquely_represented = std::integral_constant<
+            bool,
+            std::is_integral<T>::value || std::is_enum<T>::value ||
+                std::is_pointer<T>::value>;
+#endif
+
+        template<typename R>
+        using range_data_t = decltype(std::declval<R const &>().data());
+        template<typename R>
+        using range_size_t = decltype(std::declval<R const &>().size());
+
+        template<
+            typename R,
+            bool HasData = is_detected_v<range_data_t, R> &&
+                           is_detected_v<range_size_t, R>>
+        struct byte_hashable : std::false_type
+        {};
+        template<typename R>
+        struct byte_hashable<R, true>
+            : std::integral_constant<
+                  bool,
+                  std::is_pointer<range_data_t<R>>::value &&
+                      uniquely_represented<std::remove_cv_t<
+                          std::remove_pointer_t<range_data_t<R>>>>::value>
+        {};
+
+        template<typename R>
+        std::size_t hash_range_impl(R const & r, std::true_type)
+        {
+            using value_type =
+                std::remove_cv_t<std::remove_pointer_t<range_data_t<R>>>;
+            return detail::hash_bytes(r.data(), r.size() * sizeof(value_type));
+        }
+        template<typename R>
+        std::size_t hash_range_impl(R const & r, std::false_type)
+        {
+            using value_type = std::remove_cv_t<
+                std::remove_reference_t<decltype(*r.begin())>>;
+            std::hash<value_type> hasher;
+            std::uint64_t h = 0x9e3779b97f4a7c15ull;
+            for (auto it = r.begin(), last = r.end(); it != last; ++it) {
+                h = hash_mix(h ^ std::uint64_t(hasher(*it)));
+            }
+            return std::size_t(h);
+        }
+    }
+
+    /** A hash function object for ranges, suitable for use as the `Hash`
+        parameter of an unordered container.
+
+        If `r` has `data()` and `size()` members, `data()` returns a
+        pointer, and the elements have unique object representations (in
+        C++14, if they are integers, enumerations, or pointers), the elements
+        are hashed as one span of bytes.  Otherwise, each element is hashed
+        with `std::hash`, and the results are combined.
+
+        The byte-wise hash does not depend on the type of the range, so
+        equal `std::vector<int>`s and `static_vector<int, N>`s hash the same.
+        The two paths do not give the same results as each other.
+
+        To make `std::hash<C>` work for a container `C`, derive its
+        specialization from this type. */
+    struct range_hash
+    {
+        template<typename R>
+        std::size_t operator()(R const & r) const
+        {
+            return detail::hash_range_impl(r, detail::byte_hashable<R>{});
+        }
+    };
+
+}}
+
+namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
+
+    namespace v1_dtl {
+        template<typename D>
+        void contiguous_container(sequence_container_interface<
+                                  D,
+                                  element_layout::contiguous> const &);
+        template<typename D>
+        void contiguous_view(
+            view_interface<D, element_layout::contiguous> const &);
+    }
+
+    /** Returns `range_hash{}(c)`, for all containers derived from
+        `sequence_container_interface` with contiguous element layout.  This
+        is the customization point that `boost::hash` finds by ADL. */
+    template<typename ContainerInterface>
+    auto hash_value(ContainerInterface const & c)
+        -> decltype(v1_dtl::contiguous_container(c), std::size_t())
+    {
+        return range_hash{}(c);
+    }
+
+    /** Returns `range_hash{}(v)`, for all views derived from
+        `view_interface` with contiguous element layout.  This is the
+        customization point that `boost::hash` finds by ADL. */
+    template<typename ViewInterface>
+    auto hash_value(ViewInterface const & v)
+        -> decltype(v1_dtl::contiguous_view(v), std::size_t())
+    {
+        return range_hash{}(v);
+    }
+
+}}}
+
+#if defined(BOOST_STL_INTERFACES_DOXYGEN) || BOOST_STL_INTERFACES_USE_CONCEPTS
+
+namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
+
+    namespace v2_dtl {
+        template<typename D, element_layout Contiguity>
+        void derived_container(
+            sequence_container_interface<D, Contiguity> const &);
+    }
+
+    /** Returns `range_hash{}(c)`, for all containers derived from
+        `sequence_container_interface` that are contiguous ranges.  This is
+        the customization point that `boost::hash` finds by ADL.
+
+        \note There is no corresponding overload for views in C++20 and
+        later.  There, `view_interface` is `std::ranges::view_interface`, so
+        ADL cannot find a `hash_value()` in this namespace for a view; use
+        `range_hash` for views instead. */
+    template<typename ContainerInterface>
+      requires std::ranges::contiguous_range<ContainerInterface const> &&
+        requires (ContainerInterface const & c) {
+          v2_dtl::derived_container(c);
+        }
+    std::size_t hash_value(ContainerInterface const & c)
+    {
+        return range_hash{}(c);
+    }
+
+}}}
+
+#endif
+
+#endif
@@ -0,0 +1,233 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_INSTRUMENTED_ITERATOR_HPP
+#define BOOST_STL_INTERFACES_INSTRUMENTED_ITERATOR_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+namespace boost { namespace stl_interfaces {
+
+    /** Counts of the operations performed through `instrumented_iterator`s
+        on one thread. */
+    struct iterator_op_counts
+    {
+        std::size_t dereferences = 0;
+        std::size_t increments = 0;
+        std::size_t decrements = 0;
+        /** Calls to `+=` and `-=`, including the ones that `+`, `-`, and
+            `[]` are implemented with. */
+        std::size_t jumps = 0;
+        /** Calls to `it1 - it2`. */
+        std::size_t distances = 0;
+        /** Calls to `==`, `!=`, `<`, `<=`, `>`, and `>=`. */
+        std::size_t comparisons = 0;
+    };
+
+    /** Returns the operation counts for the calling thread.  The counts are
+        cumulative; assign `iterator_op_counts{}` to them to reset them. */
+    inline iterator_op_counts & instrumentation_counts() noexcept
+    {
+        static thread_local iterator_op_counts counts;
+        return counts;
+    }
+
+    namespace detail {
+        template<typename Iter>
+        using iter_category_t =
+            typename std::iterator_traits<Iter>::iterator_category;
+
+        template<typename Iter>
+        constexpr bool random_access_iter_v = std::is_base_of<
+            std::random_access_iterator_tag,
+            iter_category_t<Iter>>::value;
+        template<typename Iter>
+        constexpr bool bidirectional_iter_v = std::is_base_of<
+            std::bidirectional_iterator_tag,
+            iter_category_t<Iter>>::value;
+    }
+
+    /** An iterator adaptor that counts each operation performed on it into
+        `instrumentation_counts()`, and then performs the same operation on
+        the underlying iterator.  It has the same category, value type, and
+        reference type as `Iter`.
+
+        This is meant for measuring how many element operations an algorithm
+        or pipeline actually performs on a given kind of iterator.  For
+        example, `std::lower_bound()` over a non-random-access iterator shows
+        up as O(n) increments, rather than O(log n) jumps.
+
+        Every operation touches a `thread_local` counter, so none of them are
+        `constexpr`, and they are not free.  Use `instrumented_t` to switch
+        instrumentation on and off at compile time. */
+    template<typename Iter>
+    struct instrumented_iterator
+        : iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+              instrumented_iterator<Iter>,
+#endif
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+              typename boost::stl_interfaces::v2::v2_dtl::iter_concept_t<
+                  Iter>,
+#else
+              typename std::iterator_traits<Iter>::iterator_category,
+#endif
+              typename std::iterator_traits<Iter>::value_type,
+              typename std::iterator_traits<Iter>::reference,
+              typename std::iterator_traits<Iter>::pointer,
+              typename std::iterator_traits<Iter>::difference_type>
+    {
+        using difference_type =
+            typename std::iterator_traits<Iter>::difference_type;
+
+        constexpr instrumented_iterator() : it_() {}
+        constexpr instrumented_iterator(Iter it) : it_(it) {}
+
+        typename std::iterator_traits<Iter>::reference operator*() const
+        {
+            ++instrumentation_counts().dereferences;
+            return *it_;
+        }
+
+        instrumented_iterator & operator++()
+        {
+            ++instrumentation_counts().increments;
+            ++it_;
+            return *this;
+        }
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        instrumented_iterator & operator--()
+            requires detail::bidirectional_iter_v<Iter>
+#else
+        template<
+            typename I = Iter,
+            typename E = std::enable_if_t<detail::bidirectional_iter_v<I>>>
+        instrumented_iterator & operator--()
+#endif
+        {
+            ++instrumentation_counts().decrements;
+            --it_;
+            return *this;
+        }
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        instrumented_iterator & operator+=(difference_type n)
+            requires detail::random_access_iter_v<Iter>
+#else
+        template<
+            typename I = Iter,
+            typename E = std::enable_if_t<detail::random_access_iter_v<I>>>
+        instrumented_iterator & operator+=(difference_type n)
+#endif
+        {
+            ++instrumentation_counts().jumps;
+            it_ += n;
+            return *this;
+        }
+
+        template<
+            typename I = Iter,
+            typename E = std::enable_if_t<detail::random_access_iter_v<I>>>
+        friend difference_type
+        operator-(instrumented_iterator lhs, instrumented_iterator rhs)
+        {
+            ++instrumentation_counts().distances;
+            return lhs.it_ - rhs.it_;
+        }
+
+        friend bool
+        operator==(instrumented_iterator lhs, instrumented_iterator rhs)
+        {
+            ++instrumentation_counts().comparisons;
+            return lhs.it_ == rhs.it_;
+        }
+        friend bool
+        operator!=(instrumented_iterator lhs, instrumented_iterator rhs)
+        {
+            ++instrumentation_counts().comparisons;
+            return lhs.it_ != rhs.it_;
+        }
+        template<
+            typename I = Iter,
+            typename E = std::enable_if_t<detail::random_access_iter_v<I>>>
+        friend bool
+        operator<(instrumented_iterator lhs, instrumented_iterator rhs)
+        {
+            ++instrumentation_counts().comparisons;
+            return lhs.it_ < rhs.it_;
+        }
+        template<
+            typename I = Iter,
+            typename E = std::enable_if_t<detail::random_access_iter_v<I>>>
+        friend bool
+        operator<=(instrumented_iterator lhs, instrumented_iterator rhs)
+        {
+            ++instrumentation_counts().comparisons;
+            return lhs.it_ <= rhs.it_;
+        }
+        template<
+            typename I = Iter,
+            typename E = std::enable_if_t<detail::random_access_iter_v<I>>>
+        friend bool
+        operator>(instrumented_iterator lhs, instrumented_iterator rhs)
+        {
+            ++instrumentation_counts().comparisons;
+            return lhs.it_ > rhs.it_;
+        }
+        template<
+            typename I = Iter,
+            typename E = std::enable_if_t<detail::random_access_iter_v<I>>>
+        friend bool
+        operator>=(instrumented_iterator lhs, instrumented_iterator rhs)
+        {
+            ++instrumentation_counts().comparisons;
+            return lhs.it_ >= rhs.it_;
+        }
+
+        /** Returns the underlying iterator, without counting anything. */
+        constexpr Iter base() const { return it_; }
+
+        using base_type = iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+            instrumented_iterator<Iter>,
+#endif
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            typename boost::stl_interfaces::v2::v2_dtl::iter_concept_t<Iter>,
+#else
+            typename std::iterator_traits<Iter>::iterator_category,
+#endif
+            typename std::iterator_traits<Iter>::value_type,
+            typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::pointer,
+            typename std::iterator_traits<Iter>::difference_type>;
+        using base_type::operator++;
+        using base_type::operator--;
+
+    private:
+        Iter it_;
+    };
+
+    /** `instrumented_iterator<Iter>` if
+        `BOOST_STL_INTERFACES_INSTRUMENT_ITERATORS` is defined, and `Iter`
+        otherwise.  Naming iterator types through this alias lets a build
+        opt in to instrumentation without any cost to builds that do not.
+
+        The macro must be defined the same way in every translation unit of
+        a program that uses this alias. */
+    template<typename Iter>
+#if defined(BOOST_STL_INTERFACES_INSTRUMENT_ITERATORS) ||                      \
+    defined(BOOST_STL_INTERFACES_DOXYGEN)
+    using instrumented_t = instrumented_iterator<Iter>;
+#else
+    using instrumented_t = Iter;
+#endif
+
+}}
+
+#endif
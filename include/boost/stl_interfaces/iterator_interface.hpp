@@ -24,12 +24,14 @@ namespace boost { namespace stl_interfaces {
 #ifndef BOOST_STL_INTERFACES_DOXYGEN
 
         template<typename D>
+        BOOST_STL_INTERFACES_FORCEINLINE
         static constexpr auto base(D & d) noexcept
             -> decltype(d.base_reference())
         {
             return d.base_reference();
         }
         template<typename D>
+        BOOST_STL_INTERFACES_FORCEINLINE
         static constexpr auto base(D const & d) noexcept
             -> decltype(d.base_reference())
         {
@@ -62,7 +64,9 @@ namespace boost { namespace stl_interfaces {
             value_(std::move(value))
         {}
 
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr T const * operator->() const noexcept { return &value_; }
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr T * operator->() noexcept { return &value_; }
 
     private:
@@ -71,6 +75,7 @@ namespace boost { namespace stl_interfaces {
 
     namespace detail {
         template<typename Pointer, typename Reference, typename T>
+        BOOST_STL_INTERFACES_FORCEINLINE
         auto make_pointer(
             T && value,
             std::enable_if_t<
@@ -82,6 +87,7 @@ namespace boost { namespace stl_interfaces {
         }
 
         template<typename Pointer, typename Reference, typename T>
+        BOOST_STL_INTERFACES_FORCEINLINE
         auto make_pointer(
             T && value,
             std::enable_if_t<
@@ -142,6 +148,7 @@ namespace boost { namespace stl_interfaces {
             bool UseBase = detector<void, use_base, T>::value>
         struct common_eq
         {
+            BOOST_STL_INTERFACES_FORCEINLINE
             static constexpr auto call(T lhs, U rhs)
             {
                 return static_cast<common_t<T, U>>(lhs).derived() ==
@@ -151,6 +158,7 @@ namespace boost { namespace stl_interfaces {
         template<typename T, typename U>
         struct common_eq<T, U, true>
         {
+            BOOST_STL_INTERFACES_FORCEINLINE
             static constexpr auto call(T lhs, U rhs)
             {
                 return access::base(lhs) == access::base(rhs);
@@ -158,6 +166,7 @@ namespace boost { namespace stl_interfaces {
         };
 
         template<typename T, typename U>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto common_diff(T lhs, U rhs) noexcept(noexcept(
             static_cast<common_t<T, U>>(lhs) -
             static_cast<common_t<T, U>>(rhs)))
@@ -259,10 +268,12 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
     {
 #ifndef BOOST_STL_INTERFACES_DOXYGEN
     private:
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr Derived & derived() noexcept
         {
             return static_cast<Derived &>(*this);
         }
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr Derived const & derived() const noexcept
         {
             return static_cast<Derived const &>(*this);
@@ -281,6 +292,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         using difference_type = DifferenceType;
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator*()
             noexcept(noexcept(*access::base(std::declval<D &>())))
                 -> decltype(*access::base(std::declval<D &>()))
@@ -288,6 +300,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return *access::base(derived());
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator*() const
             noexcept(noexcept(*access::base(std::declval<D const &>())))
                 -> decltype(*access::base(std::declval<D const &>()))
@@ -296,6 +309,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator->() noexcept(noexcept(
             detail::make_pointer<pointer, reference>(*std::declval<D &>())))
             -> decltype(
@@ -304,6 +318,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return detail::make_pointer<pointer, reference>(*derived());
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator->() const noexcept(noexcept(
             detail::make_pointer<pointer, reference>(
                 *std::declval<D const &>())))
@@ -315,6 +330,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator[](difference_type i) const noexcept(noexcept(
             D(std::declval<D const &>()),
             std::declval<D &>() += i,
@@ -330,6 +346,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             typename D = Derived,
             typename Enable =
                 std::enable_if_t<!v1_dtl::plus_eq<D, difference_type>::value>>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto
         operator++() noexcept(noexcept(++access::base(std::declval<D &>())))
             -> decltype(
@@ -340,6 +357,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator++() noexcept(
             noexcept(std::declval<D &>() += difference_type(1)))
             -> decltype(
@@ -349,6 +367,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived();
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator++(int)noexcept(
             noexcept(D(std::declval<D &>()), ++std::declval<D &>()))
             -> std::remove_reference_t<decltype(
@@ -362,6 +381,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator+=(difference_type n) noexcept(
             noexcept(access::base(std::declval<D &>()) += n))
             -> decltype(
@@ -372,6 +392,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator+(difference_type i) const
             noexcept(noexcept(D(std::declval<D &>()), std::declval<D &>() += i))
                 -> std::remove_reference_t<decltype(
@@ -383,7 +404,8 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             retval += i;
             return retval;
         }
-        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR Derived
+        friend BOOST_STL_INTERFACES_FORCEINLINE
+        BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR Derived
         operator+(difference_type i, Derived it) noexcept
         {
             return it + i;
@@ -393,6 +415,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             typename D = Derived,
             typename Enable =
                 std::enable_if_t<!v1_dtl::plus_eq<D, difference_type>::value>>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto
         operator--() noexcept(noexcept(--access::base(std::declval<D &>())))
             -> decltype(--access::base(std::declval<D &>()), std::declval<D &>())
@@ -402,6 +425,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator--() noexcept(noexcept(
             D(std::declval<D &>()), std::declval<D &>() += -difference_type(1)))
             -> decltype(
@@ -411,6 +435,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived();
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator--(int)noexcept(
             noexcept(D(std::declval<D &>()), --std::declval<D &>()))
             -> std::remove_reference_t<decltype(
@@ -424,6 +449,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr D & operator-=(difference_type i) noexcept
         {
             derived() += -i;
@@ -431,6 +457,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator-(D other) const noexcept(noexcept(
             access::base(std::declval<D const &>()) - access::base(other)))
             -> decltype(
@@ -439,7 +466,8 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return access::base(derived()) - access::base(other);
         }
 
-        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR Derived
+        friend BOOST_STL_INTERFACES_FORCEINLINE
+        BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR Derived
         operator-(Derived it, difference_type i) noexcept
         {
             Derived retval = it;
@@ -457,6 +485,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         typename IteratorInterface2,
         typename Enable =
             std::enable_if_t<!v1_dtl::ra_iter<IteratorInterface1>::value>>
+    BOOST_STL_INTERFACES_FORCEINLINE
     constexpr auto
     operator==(IteratorInterface1 lhs, IteratorInterface2 rhs) noexcept
         -> decltype(
@@ -474,6 +503,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         typename IteratorInterface2,
         typename Enable =
             std::enable_if_t<v1_dtl::ra_iter<IteratorInterface1>::value>>
+    BOOST_STL_INTERFACES_FORCEINLINE
     constexpr auto
     operator==(IteratorInterface1 lhs, IteratorInterface2 rhs) noexcept(
         noexcept(detail::common_diff(lhs, rhs)))
@@ -486,6 +516,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
     /** Implementation of `operator!=()` for all iterators derived from
         `iterator_interface`.  */
     template<typename IteratorInterface1, typename IteratorInterface2>
+    BOOST_STL_INTERFACES_FORCEINLINE
     constexpr auto operator!=(
         IteratorInterface1 lhs,
         IteratorInterface2 rhs) noexcept(noexcept(!(lhs == rhs)))
@@ -498,6 +529,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         `iterator_interface` that have an iterator category derived from
         `std::random_access_iterator_tag`.  */
     template<typename IteratorInterface1, typename IteratorInterface2>
+    BOOST_STL_INTERFACES_FORCEINLINE
     constexpr auto
     operator<(IteratorInterface1 lhs, IteratorInterface2 rhs) noexcept(
         noexcept(detail::common_diff(lhs, rhs)))
@@ -511,6 +543,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         `iterator_interface` that have an iterator category derived from
         `std::random_access_iterator_tag`.  */
     template<typename IteratorInterface1, typename IteratorInterface2>
+    BOOST_STL_INTERFACES_FORCEINLINE
     constexpr auto
     operator<=(IteratorInterface1 lhs, IteratorInterface2 rhs) noexcept(
         noexcept(detail::common_diff(lhs, rhs)))
@@ -524,6 +557,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         `iterator_interface` that have an iterator category derived from
         `std::random_access_iterator_tag`.  */
     template<typename IteratorInterface1, typename IteratorInterface2>
+    BOOST_STL_INTERFACES_FORCEINLINE
     constexpr auto
     operator>(IteratorInterface1 lhs, IteratorInterface2 rhs) noexcept(
         noexcept(detail::common_diff(lhs, rhs)))
@@ -537,6 +571,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         `iterator_interface` that have an iterator category derived from
         `std::random_access_iterator_tag`.  */
     template<typename IteratorInterface1, typename IteratorInterface2>
+    BOOST_STL_INTERFACES_FORCEINLINE
     constexpr auto
     operator>=(IteratorInterface1 lhs, IteratorInterface2 rhs) noexcept(
         noexcept(detail::common_diff(lhs, rhs)))
@@ -723,9 +758,11 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
         : v2_dtl::iterator_category_base<IteratorConcept, Reference>
     {
     private:
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr D& derived() noexcept {
         return static_cast<D&>(*this);
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr const D& derived() const noexcept {
         return static_cast<const D&>(*this);
       }
@@ -737,26 +774,31 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
       using pointer = detail::pointer_t<Pointer, iterator_concept>;
       using difference_type = DifferenceType;
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator*()
         requires requires (D d) { *access::base(d); } {
           return *access::base(derived());
         }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator*() const
         requires requires (D const d) { *access::base(d); } {
           return *access::base(derived());
         }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator->()
         requires (!std::same_as<pointer, void> && std::is_reference_v<reference> &&
                   requires (D d) { *d; }) {
           return detail::make_pointer<pointer, reference>(*derived());
         }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator->() const
         requires (!std::same_as<pointer, void> && std::is_reference_v<reference> &&
                   requires (D const d) { *d; }) {
           return detail::make_pointer<pointer, reference>(*derived());
         }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator[](difference_type n) const
         requires requires (D const d) { d + n; } {
         D retval = derived();
@@ -764,16 +806,19 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
         return *retval;
       }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator++()
         requires requires (D d) { ++access::base(d); } &&
           (!v2_dtl::plus_eq<D, difference_type>) {
             ++access::base(derived());
             return derived();
           }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator++()
         requires requires (D d) { d += difference_type(1); } {
           return derived() += difference_type(1);
         }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator++(int) requires requires (D d) { ++d; } {
         if constexpr (std::is_same_v<IteratorConcept, std::input_iterator_tag>){
           ++derived();
@@ -783,27 +828,32 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
           return retval;
         }
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator+=(difference_type n)
         requires requires (D d) { access::base(d) += n; } {
           access::base(derived()) += n;
           return derived();
         }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator--()
         requires requires (D d) { --access::base(d); } &&
           (!v2_dtl::plus_eq<D, difference_type>) {
             --access::base(derived());
             return derived();
           }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator--()
         requires requires (D d) { d += -difference_type(1); } {
           return derived() += -difference_type(1);
         }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator--(int) requires requires (D d) { --d; } {
         D retval = derived();
         --derived();
         return retval;
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator-=(difference_type n)
         requires requires (D d) { d += -n; } {
           return derived() += -n;
@@ -831,26 +881,31 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
     }
 
     template<typename D>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator+(D it, typename D::difference_type n)
         requires v2_dtl::derived_iter<D> && requires { it += n; }
           { return it += n; }
     template<typename D>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator+(typename D::difference_type n, D it)
         requires v2_dtl::derived_iter<D> && requires { it += n; }
           { return it += n; }
 
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator-(D1 lhs, D2 rhs)
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> &&
                  requires { access::base(lhs) - access::base(rhs); }
           { return access::base(lhs) - access::base(rhs); }
     template<typename D>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator-(D it, typename D::difference_type n)
         requires v2_dtl::derived_iter<D> && requires { it += -n; }
           { return it += -n; }
 
 #if defined(__cpp_lib_three_way_comparison)
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator<=>(D1 lhs, D2 rhs)
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> &&
         (v2_dtl::base_3way<D1, D2> || v2_dtl::iter_sub<D1, D2>) {
@@ -866,23 +921,28 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
         }
 #endif
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator<(D1 lhs, D2 rhs)
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2>
           { return (lhs - rhs) < typename D1::difference_type(0); }
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator<=(D1 lhs, D2 rhs)
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2>
           { return (lhs - rhs) <= typename D1::difference_type(0); }
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator>(D1 lhs, D2 rhs)
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2>
           { return (lhs - rhs) > typename D1::difference_type(0); }
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator>=(D1 lhs, D2 rhs)
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> && v2_dtl::iter_sub<D1, D2>
           { return (lhs - rhs) >= typename D1::difference_type(0); }
 
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator==(D1 lhs, D2 rhs)
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2> &&
                  detail::interoperable<D1, D2>::value &&
@@ -895,6 +955,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
       }
 
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator!=(D1 lhs, D2 rhs) -> decltype(!(lhs == rhs))
         requires v2_dtl::derived_iter<D1> && v2_dtl::derived_iter<D2>
           { return !(lhs == rhs); }
@@ -945,16 +1006,19 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V3 {
       using pointer = detail::pointer_t<Pointer, iterator_concept>;
       using difference_type = DifferenceType;
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator*(this auto&& self)
           requires requires { *access::base(self); } {
           return *access::base(self);
       }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator->(this auto&& self)
         requires (!std::same_as<pointer, void>) && std::is_reference_v<reference> && requires { *self; } {
           return detail::make_pointer<pointer, reference>(*self);
         }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator[](this auto const& self, difference_type n)
         requires requires { self + n; } {
         auto retval = self;
@@ -962,15 +1026,18 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V3 {
         return *retval;
       }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator++(this auto& self)
         requires requires { ++access::base(self); } && (!requires { self += difference_type(1); }) {
           ++access::base(self);
           return self;
         }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator++(this auto& self)
         requires requires { self += difference_type(1); } {
           return self += difference_type(1);
         }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator++(this auto& self, int) requires requires { ++self; } {
         if constexpr (std::is_same_v<IteratorConcept, std::input_iterator_tag>){
           ++self;
@@ -980,26 +1047,31 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V3 {
           return retval;
         }
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator+=(this auto& self, difference_type n)
         requires requires { access::base(self) += n; } {
           access::base(self) += n;
           return self;
         }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator--(this auto& self)
           requires requires { --access::base(self); } && (!requires { self += difference_type(1); }) {
             --access::base(self);
             return self;
           }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator--(this auto& self)
         requires requires { self += -difference_type(1); } {
           return self += -difference_type(1);
         }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator--(this auto& self, int) requires requires { --self; } {
         auto retval = self;
         --self;
         return retval;
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) operator-=(this auto& self, difference_type n)
         requires requires { self += -n; } {
           return self += -n;
@@ -1025,26 +1097,31 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V3 {
     }
 
     template<typename D>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator+(D it, typename D::difference_type n)
         requires v3_dtl::derived_iter<D> && requires { it += n; }
           { return it += n; }
     template<typename D>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator+(typename D::difference_type n, D it)
         requires v3_dtl::derived_iter<D> && requires { it += n; }
           { return it += n; }
 
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator-(D1 lhs, D2 rhs)
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> &&
                  requires { access::base(lhs) - access::base(rhs); }
           { return access::base(lhs) - access::base(rhs); }
     template<typename D>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator-(D it, typename D::difference_type n)
         requires v3_dtl::derived_iter<D> && requires { it += -n; }
           { return it += -n; }
 
 #if defined(__cpp_lib_three_way_comparison)
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator<=>(D1 lhs, D2 rhs)
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> &&
         (v2::v2_dtl::base_3way<D1, D2> || v2::v2_dtl::iter_sub<D1, D2>) {
@@ -1060,23 +1137,28 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V3 {
         }
 #endif
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator<(D1 lhs, D2 rhs)
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2>
           { return (lhs - rhs) < typename D1::difference_type(0); }
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator<=(D1 lhs, D2 rhs)
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2>
           { return (lhs - rhs) <= typename D1::difference_type(0); }
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator>(D1 lhs, D2 rhs)
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2>
           { return (lhs - rhs) > typename D1::difference_type(0); }
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator>=(D1 lhs, D2 rhs)
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> && v2::v2_dtl::iter_sub<D1, D2>
           { return (lhs - rhs) >= typename D1::difference_type(0); }
 
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool operator==(D1 lhs, D2 rhs)
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2> &&
                  detail::interoperable<D1, D2>::value &&
@@ -1089,6 +1171,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V3 {
       }
 
     template<typename D1, typename D2>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto operator!=(D1 lhs, D2 rhs) -> decltype(!(lhs == rhs))
         requires v3_dtl::derived_iter<D1> && v3_dtl::derived_iter<D2>
           { return !(lhs == rhs); }
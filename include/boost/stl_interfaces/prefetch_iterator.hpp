@@ -0,0 +1,188 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_PREFETCH_ITERATOR_HPP
+#define BOOST_STL_INTERFACES_PREFETCH_ITERATOR_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include <boost/type_traits/is_detected.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+
+namespace boost { namespace stl_interfaces {
+
+    namespace detail {
+        /** Hints that `p` will be read soon.  This is a no-op on compilers
+            without a prefetch intrinsic. */
+        inline void prefetch(void const * p) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(p);
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+            _mm_prefetch(static_cast<char const *>(p), _MM_HINT_T0);
+#else
+            (void)p;
+#endif
+        }
+
+        template<typename Iter>
+        using prefetch_address_expr =
+            decltype(std::declval<Iter const &>().prefetch_address());
+
+        template<
+            typename Iter,
+            bool HasMember = is_detected_v<prefetch_address_expr, Iter>>
+        struct prefetch_address_impl
+        {
+            static void const * call(Iter const & it)
+            {
+                return it.prefetch_address();
+            }
+        };
+        template<typename Iter>
+        struct prefetch_address_impl<Iter, false>
+        {
+            static_assert(
+                std::is_lvalue_reference<
+                    typename std::iterator_traits<Iter>::reference>::value,
+                "An iterator whose reference type is not a reference must "
+                "provide a prefetch_address() member to be used with "
+                "prefetch_iterator.");
+            static void const * call(Iter const & it)
+            {
+                return std::addressof(*it);
+            }
+        };
+    }
+
+    /** A forward iterator adaptor that prefetches the element `Distance`
+        positions ahead of the current one.
+
+        It is meant for pointer-chasing iterators, such as iterators over
+        linked lists or hash chains, where each increment is a dependent load
+        that usually misses the cache.  A `prefetch_iterator` keeps a second,
+        leading iterator `Distance` positions ahead of the current one; each
+        increment advances the leading iterator too, and prefetches the
+        element it lands on.  By the time the current iterator gets there,
+        that element has had `Distance` iterations' worth of work to arrive,
+        so the current iterator's reads of it, and its own increments, hit
+        the cache.
+
+        This does not make the chain itself any faster.  The leading
+        iterator's increment reads the node it is on, which was only
+        prefetched one iteration earlier, so the leading walk still waits on
+        roughly one miss per step, whatever `Distance` is.  What the adaptor
+        hides is the latency of the per-element work done through the
+        current iterator, by overlapping it with the leading walk; a loop
+        that does little besides following the links will not get faster.
+
+        The address prefetched is `it.prefetch_address()`, if the underlying
+        iterator has such a member, and `std::addressof(*it)` otherwise.  A
+        node-based iterator should define `prefetch_address()` to return the
+        address of its node, if the node's link does not share a cache line
+        with the element.
+
+        The leading iterator never goes past `last`, so the adaptor must be
+        given the end of the sequence it traverses.  The cost is two more
+        `Iter`s per iterator, and one more increment and comparison per
+        increment.  Equality compares only the current positions. */
+    template<typename Iter, std::ptrdiff_t Distance = 2>
+    struct prefetch_iterator : iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                                   prefetch_iterator<Iter, Distance>,
+#endif
+                                   std::forward_iterator_tag,
+                                   typename std::iterator_traits<
+                                       Iter>::value_type,
+                                   typename std::iterator_traits<
+                                       Iter>::reference,
+                                   typename std::iterator_traits<
+                                       Iter>::pointer,
+                                   typename std::iterator_traits<
+                                       Iter>::difference_type>
+    {
+        static_assert(0 < Distance, "Distance must be positive.");
+
+        constexpr prefetch_iterator() : it_(), lead_(), last_() {}
+        prefetch_iterator(Iter it, Iter last) :
+            it_(it), lead_(it), last_(last)
+        {
+            for (std::ptrdiff_t i = 0; i < Distance && lead_ != last_; ++i) {
+                ++lead_;
+                prefetch_lead();
+            }
+        }
+
+        constexpr typename std::iterator_traits<Iter>::reference
+        operator*() const
+        {
+            return *it_;
+        }
+
+        prefetch_iterator & operator++()
+        {
+            ++it_;
+            if (lead_ != last_) {
+                ++lead_;
+                prefetch_lead();
+            }
+            return *this;
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+        operator==(prefetch_iterator lhs, prefetch_iterator rhs)
+        {
+            return lhs.it_ == rhs.it_;
+        }
+
+        /** Returns the current position. */
+        constexpr Iter base() const { return it_; }
+
+        using base_type = iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+            prefetch_iterator<Iter, Distance>,
+#endif
+            std::forward_iterator_tag,
+            typename std::iterator_traits<Iter>::value_type,
+            typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::pointer,
+            typename std::iterator_traits<Iter>::difference_type>;
+        using base_type::operator++;
+
+    private:
+        void prefetch_lead()
+        {
+            if (lead_ != last_) {
+                detail::prefetch(
+                    detail::prefetch_address_impl<Iter>::call(lead_));
+            }
+        }
+
+        Iter it_;
+        Iter lead_;
+        Iter last_;
+    };
+
+    /** Makes a `prefetch_iterator<Iter, Distance>` that starts at `it`, and
+        prefetches no further than `last`.  For a traversal of `[first,
+        last)`, the end iterator is `make_prefetch_iterator(last, last)`. */
+    template<std::ptrdiff_t Distance = 2, typename Iter>
+    prefetch_iterator<Iter, Distance> make_prefetch_iterator(Iter it, Iter last)
+    {
+        return prefetch_iterator<Iter, Distance>(it, last);
+    }
+
+}}
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_REMOVE_HPP
+#define BOOST_STL_INTERFACES_REMOVE_HPP
+
+#include <boost/stl_interfaces/detail/algorithm_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace boost { namespace stl_interfaces {
+    namespace detail {
+        // Small, trivially copyable elements in contiguous memory can be
+        // compacted without a branch per element.  For larger elements,
+        // copying every one costs more than the branch saves.
+        template<typename Iter>
+        using remove_strategy = std::integral_constant<
+            bool,
+            contiguous_iter_v<Iter> &&
+                std::is_trivially_copyable<iter_value_t<Iter>>::value &&
+                sizeof(iter_value_t<Iter>) <= 2 * sizeof(void *)>;
+
+        template<typename Iter, typename Pred>
+        constexpr Iter
+        remove_if_impl(Iter first, Iter last, Pred & pred, std::false_type)
+        {
+            return std::remove_if(first, last, pred);
+        }
+        // Every element is copied to the output position, which only
+        // advances past the elements that are kept.  The loop has no
+        // data-dependent branches, so it does not mispredict when the
+        // elements removed are scattered, and compilers can vectorize it.
+        template<typename Iter, typename Pred>
+        constexpr Iter
+        remove_if_impl(Iter first, Iter last, Pred & pred, std::true_type)
+        {
+            first = std::find_if(first, last, pred);
+            if (first == last)
+                return first;
+            auto const base = std::addressof(*first);
+            auto out = base;
+            auto const n = last - first;
+            for (std::ptrdiff_t i = 1; i < n; ++i) {
+                auto const x = base[i];
+                *out = x;
+                out += !static_cast<bool>(pred(x));
+            }
+            return first + (out - base);
+        }
+
+        struct remove_if_fn
+        {
+            template<typename ForwardIterator, typename Pred>
+            constexpr ForwardIterator operator()(
+                ForwardIterator first, ForwardIterator last, Pred pred) const
+            {
+                return detail::remove_if_impl(
+                    first, last, pred, remove_strategy<ForwardIterator>{});
+            }
+        };
+
+        struct remove_fn
+        {
+            template<typename ForwardIterator, typename T>
+            constexpr ForwardIterator operator()(
+                ForwardIterator first, ForwardIterator last, T const & x) const
+            {
+                auto pred = [&x](auto const & y) { return y == x; };
+                return detail::remove_if_impl(
+                    first, last, pred, remove_strategy<ForwardIterator>{});
+            }
+        };
+    }
+
+    // Like the algorithms in algorithm.hpp, these are function objects, so
+    // that they are never found by ADL.  They live in this smaller header
+    // because sequence_container_interface uses them to implement erase()
+    // and erase_if().
+
+#if defined(__cpp_inline_variables) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+    /** Moves the elements `x` of `[first, last)` for which `pred(x)` is
+        false to the front of the range, and returns the end of them, like
+        `std::remove_if()`.  For contiguous iterators to trivially copyable
+        elements no larger than two pointers, the compaction is done without
+        branching on `pred(x)`;
+        `pred` is then passed a copy of each element, rather than the element
+        itself. */
+    inline constexpr detail::remove_if_fn remove_if{};
+
+    /** Like `remove_if()`, with a predicate that is true for elements equal
+        to `x`. */
+    inline constexpr detail::remove_fn remove{};
+#else
+    namespace {
+        constexpr detail::remove_if_fn remove_if{};
+        constexpr detail::remove_fn remove{};
+    }
+#endif
+
+}}
+
+#endif
@@ -169,9 +169,178 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         return reverse_iterator<BidiIter>(it);
     }
 
+    /** Returns `it.base()`.  Reversing a reverse iterator gives back the
+        original iterator, rather than a doubly-wrapped one that has to undo
+        both wrappers on every operation. */
+    template<typename BidiIter>
+    BidiIter make_reverse_iterator(reverse_iterator<BidiIter> it)
+    {
+        return it.base();
+    }
+
 }}}
 
 
+namespace boost { namespace stl_interfaces {
+
+    /** A reverse iterator that caches the position its last dereference
+        decremented to.
+
+        `reverse_iterator` dereferences `std::prev(base())`, which means that
+        a reverse traversal that dereferences each element decrements the
+        underlying iterator twice per element: once in `operator*()`, and
+        once in `operator++()`.  That is cheap for pointers, but not for
+        iterators whose decrement is expensive, such as node-based or
+        decoding iterators.  `caching_reverse_iterator` keeps the result of
+        the decrement done in `operator*()`, and reuses it in `operator++()`,
+        so such a traversal does one decrement per element.
+
+        The cost is one extra `BidiIter` and a flag per iterator, and
+        `operator*()` is not `constexpr`.
+
+        \warning Because `operator*()` fills the cache, it modifies the
+        iterator even though it is `const`.  Unlike standard iterators, one
+        `caching_reverse_iterator` object must not be dereferenced from
+        more than one thread at a time without synchronization; give each
+        thread its own copy instead.  The cache cannot be filled by
+        `operator++()` instead, since that would decrement past the
+        beginning of the underlying range when the iterator reaches the
+        end. */
+    template<typename BidiIter>
+    struct caching_reverse_iterator
+        : iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+              caching_reverse_iterator<BidiIter>,
+#endif
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+              typename boost::stl_interfaces::v2::v2_dtl::iter_concept_t<
+                  BidiIter>,
+#else
+              typename std::iterator_traits<BidiIter>::iterator_category,
+#endif
+              typename std::iterator_traits<BidiIter>::value_type,
+              typename std::iterator_traits<BidiIter>::reference,
+              typename std::iterator_traits<BidiIter>::pointer,
+              typename std::iterator_traits<BidiIter>::difference_type>
+    {
+        using difference_type =
+            typename std::iterator_traits<BidiIter>::difference_type;
+
+        constexpr caching_reverse_iterator() : it_(), cur_(), cached_(false) {}
+        constexpr caching_reverse_iterator(BidiIter it) :
+            it_(it), cur_(it), cached_(false)
+        {}
+        template<
+            typename BidiIter2,
+            typename E = std::enable_if_t<
+                std::is_convertible<BidiIter2, BidiIter>::value>>
+        caching_reverse_iterator(
+            caching_reverse_iterator<BidiIter2> const & it) :
+            it_(it.it_), cur_(it.cur_), cached_(it.cached_)
+        {}
+
+        typename std::iterator_traits<BidiIter>::reference operator*() const
+        {
+            if (!cached_) {
+                cur_ = v1::v1_dtl::ce_prev(it_);
+                cached_ = true;
+            }
+            return *cur_;
+        }
+
+        caching_reverse_iterator & operator++()
+        {
+            if (cached_) {
+                it_ = cur_;
+                cached_ = false;
+            } else {
+                --it_;
+            }
+            return *this;
+        }
+        // After the increment, std::prev(it_) is the old it_, so the cache
+        // can be filled for free.
+        caching_reverse_iterator & operator--()
+        {
+            cur_ = it_;
+            ++it_;
+            cached_ = true;
+            return *this;
+        }
+        template<
+            typename I = BidiIter,
+            typename E = std::enable_if_t<std::is_base_of<
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<I>::iterator_category>::value>>
+        caching_reverse_iterator & operator+=(difference_type n)
+        {
+            it_ -= n;
+            cached_ = false;
+            return *this;
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR auto
+        operator-(caching_reverse_iterator lhs, caching_reverse_iterator rhs)
+        {
+            return -v1::v1_dtl::ce_dist(
+                rhs.it_,
+                lhs.it_,
+                typename std::iterator_traits<BidiIter>::iterator_category{});
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool operator==(
+            caching_reverse_iterator lhs, caching_reverse_iterator rhs)
+        {
+            return lhs.it_ == rhs.it_;
+        }
+
+        constexpr BidiIter base() const { return it_; }
+
+        using base_type = iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+            caching_reverse_iterator<BidiIter>,
+#endif
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            typename boost::stl_interfaces::v2::v2_dtl::iter_concept_t<
+                BidiIter>,
+#else
+            typename std::iterator_traits<BidiIter>::iterator_category,
+#endif
+            typename std::iterator_traits<BidiIter>::value_type,
+            typename std::iterator_traits<BidiIter>::reference,
+            typename std::iterator_traits<BidiIter>::pointer,
+            typename std::iterator_traits<BidiIter>::difference_type>;
+        using base_type::operator++;
+        using base_type::operator--;
+
+    private:
+        template<typename BidiIter2>
+        friend struct caching_reverse_iterator;
+
+        BidiIter it_;
+        mutable BidiIter cur_;
+        mutable bool cached_;
+    };
+
+    /** Makes a `caching_reverse_iterator<BidiIter>` from an iterator of type
+        `BidiIter`. */
+    template<typename BidiIter>
+    auto make_caching_reverse_iterator(BidiIter it)
+    {
+        return caching_reverse_iterator<BidiIter>(it);
+    }
+
+    /** Returns `it.base()`. */
+    template<typename BidiIter>
+    BidiIter
+    make_caching_reverse_iterator(caching_reverse_iterator<BidiIter> it)
+    {
+        return it.base();
+    }
+
+}}
+
+
 #if defined(BOOST_STL_INTERFACES_DOXYGEN) || BOOST_STL_INTERFACES_USE_CONCEPTS
 
 namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
@@ -193,6 +362,15 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
         return reverse_iterator<BidiIter>(it);
     }
 
+    /** Returns `it.base()`.  Reversing a reverse iterator gives back the
+        original iterator, rather than a doubly-wrapped one that has to undo
+        both wrappers on every operation. */
+    template<typename BidiIter>
+    BidiIter make_reverse_iterator(std::reverse_iterator<BidiIter> it)
+    {
+        return it.base();
+    }
+
 }}}
 
 namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V3 {
@@ -214,6 +392,15 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V3 {
         return reverse_iterator<BidiIter>(it);
     }
 
+    /** Returns `it.base()`.  Reversing a reverse iterator gives back the
+        original iterator, rather than a doubly-wrapped one that has to undo
+        both wrappers on every operation. */
+    template<typename BidiIter>
+    BidiIter make_reverse_iterator(std::reverse_iterator<BidiIter> it)
+    {
+        return it.base();
+    }
+
 }}}
 
 #endif
@@ -6,10 +6,13 @@
 #ifndef BOOST_STL_INTERFACES_CONTAINER_INTERFACE_HPP
 #define BOOST_STL_INTERFACES_CONTAINER_INTERFACE_HPP
 
+#include <boost/stl_interfaces/generating_iterators.hpp>
+#include <boost/stl_interfaces/remove.hpp>
 #include <boost/stl_interfaces/reverse_iterator.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
+#include <boost/type_traits/is_detected.hpp>
 
 #include <algorithm>
 #include <stdexcept>
@@ -19,45 +22,23 @@
 
 namespace boost { namespace stl_interfaces { namespace detail {
 
+    // insert(pos, n, x) and assign(n, x) pass these to the user's
+    // insert(pos, first, last), so that it can recognize them as a fill.
     template<typename T, typename SizeType>
-    struct n_iter : iterator_interface<
-#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
-                        n_iter<T, SizeType>,
-#endif
-                        std::random_access_iterator_tag,
-                        T>
-    {
-        n_iter() : x_(nullptr), n_(0) {}
-        n_iter(T const & x, SizeType n) : x_(&x), n_(n) {}
-
-        T const & operator*() const { return *x_; }
-        constexpr std::ptrdiff_t operator-(n_iter other) const noexcept
-        {
-            return std::ptrdiff_t(n_) - std::ptrdiff_t(other.n_);
-        }
-        n_iter & operator+=(std::ptrdiff_t offset)
-        {
-            n_ += offset;
-            return *this;
-        }
-
-    private:
-        T const * x_;
-        SizeType n_;
-    };
+    using n_iter = repeat_iterator<T>;
 
     template<typename T, typename SizeType>
     constexpr auto make_n_iter(T const & x, SizeType n) noexcept(
         noexcept(n_iter<T, SizeType>(x, n)))
     {
         using result_type = n_iter<T, SizeType>;
-        return result_type(x, SizeType(0));
+        return result_type(x, 0);
     }
     template<typename T, typename SizeType>
     constexpr auto make_n_iter_end(T const & x, SizeType n) noexcept(
         noexcept(n_iter<T, SizeType>(x, n)))
     {
-        return n_iter<T, SizeType>(x, n);
+        return n_iter<T, SizeType>(x, std::ptrdiff_t(n));
     }
 
     template<typename Container>
@@ -74,8 +55,80 @@ namespace boost { namespace stl_interfaces { namespace detail {
         return c.capacity();
     }
 
+    template<typename Container>
+    using reserve_expr = decltype(std::declval<Container &>().reserve(
+        std::declval<typename Container::size_type>()));
+
+    // Calls c.reserve(), if c has one.
+    template<
+        typename Container,
+        bool HasReserve = is_detected_v<reserve_expr, Container>>
+    struct reserve_impl
+    {
+        static constexpr void call(Container & c, std::size_t n)
+        {
+            c.reserve(typename Container::size_type(n));
+        }
+
+        // Reserves room for n more elements, and returns pos, adjusted for
+        // any reallocation.
+        template<typename ConstIter>
+        static constexpr ConstIter
+        for_insert(Container & c, ConstIter pos, std::size_t n)
+        {
+            ConstIter const first = c.begin();
+            auto const offset = std::distance(first, pos);
+            c.reserve(typename Container::size_type(c.size() + n));
+            return std::next(ConstIter(c.begin()), offset);
+        }
+    };
+    template<typename Container>
+    struct reserve_impl<Container, false>
+    {
+        static constexpr void call(Container &, std::size_t) {}
+
+        template<typename ConstIter>
+        static constexpr ConstIter
+        for_insert(Container &, ConstIter pos, std::size_t)
+        {
+            return pos;
+        }
+    };
+
 }}}
 
+namespace boost { namespace stl_interfaces {
+
+    /** Inserts the elements of `[first, last)` into `c` before `pos`, and
+        returns an iterator to the first inserted element.
+
+        This is meant for input iterators, whose elements can only be read
+        once, and whose number is not known in advance.  Inserting them one
+        at a time at `pos` shifts the tail of `c` once per element, which is
+        O(n*m).  Instead, this appends each element with `emplace_back()`,
+        and then moves them all into place with a single `std::rotate()`, for
+        O(n+m) overall. */
+    template<typename Container, typename InputIterator>
+    constexpr auto append_and_rotate(
+        Container & c,
+        typename Container::const_iterator pos,
+        InputIterator first,
+        InputIterator last)
+        -> decltype((void)c.emplace_back(*first), c.begin())
+    {
+        typename Container::const_iterator const c_first = c.begin();
+        auto const offset = std::distance(c_first, pos);
+        auto const old_size = decltype(offset)(c.size());
+        for (; first != last; ++first) {
+            c.emplace_back(*first);
+        }
+        auto const retval = std::next(c.begin(), offset);
+        std::rotate(retval, std::next(c.begin(), old_size), c.end());
+        return retval;
+    }
+
+}}
+
 namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
 
     /** A CRTP template that one may derive from to make it easier to define
@@ -112,6 +165,10 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         using in_iter = std::is_convertible<
             typename std::iterator_traits<Iter>::iterator_category,
             std::input_iterator_tag>;
+        template<typename Iter>
+        using fwd_iter = std::is_convertible<
+            typename std::iterator_traits<Iter>::iterator_category,
+            std::forward_iterator_tag>;
 
         template<typename D, typename = void>
         struct clear_impl
@@ -126,6 +183,44 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
 
         template<typename D, element_layout Contiguity>
         void derived_container(sequence_container_interface<D, Contiguity> const &);
+
+        template<typename R>
+        using range_iter_t = decltype(std::begin(std::declval<R &>()));
+
+        // In C++14, only a range with random access iterators counts as
+        // sized.
+        template<
+            typename Iter,
+            bool RandomAccess = std::is_base_of<
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<Iter>::iterator_category>::value>
+        struct reserve_range_impl
+        {
+            template<typename D>
+            static constexpr void call(D & d, Iter first, Iter last)
+            {
+                detail::reserve_impl<D>::call(d, std::size_t(last - first));
+            }
+            template<typename D, typename ConstIter>
+            static constexpr ConstIter
+            for_insert(D & d, ConstIter pos, Iter first, Iter last)
+            {
+                return detail::reserve_impl<D>::for_insert(
+                    d, pos, std::size_t(last - first));
+            }
+        };
+        template<typename Iter>
+        struct reserve_range_impl<Iter, false>
+        {
+            template<typename D>
+            static constexpr void call(D &, Iter, Iter) {}
+            template<typename D, typename ConstIter>
+            static constexpr ConstIter
+            for_insert(D &, ConstIter pos, Iter, Iter)
+            {
+                return pos;
+            }
+        };
     }
 
     template<
@@ -140,14 +235,17 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
     {
 #ifndef BOOST_STL_INTERFACES_DOXYGEN
     private:
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr Derived & derived() noexcept
         {
             return static_cast<Derived &>(*this);
         }
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr const Derived & derived() const noexcept
         {
             return static_cast<Derived const &>(*this);
         }
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr Derived & mutable_derived() const noexcept
         {
             return const_cast<Derived &>(static_cast<Derived const &>(*this));
@@ -156,6 +254,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
 
     public:
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto empty() noexcept(
             noexcept(std::declval<D &>().begin() == std::declval<D &>().end()))
             -> decltype(
@@ -164,6 +263,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived().begin() == derived().end();
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto empty() const noexcept(noexcept(
             std::declval<D const &>().begin() ==
             std::declval<D const &>().end()))
@@ -178,6 +278,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             typename D = Derived,
             element_layout C = Contiguity,
             typename Enable = std::enable_if_t<C == element_layout::contiguous>>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto data() noexcept(noexcept(std::declval<D &>().begin()))
             -> decltype(std::addressof(*std::declval<D &>().begin()))
         {
@@ -187,6 +288,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             typename D = Derived,
             element_layout C = Contiguity,
             typename Enable = std::enable_if_t<C == element_layout::contiguous>>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto data() const
             noexcept(noexcept(std::declval<D const &>().begin()))
                 -> decltype(std::addressof(*std::declval<D const &>().begin()))
@@ -195,6 +297,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto size()
 #if !BOOST_CLANG
             noexcept(noexcept(
@@ -206,6 +309,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived().end() - derived().begin();
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto size() const noexcept(noexcept(
             std::declval<D const &>().end() -
             std::declval<D const &>().begin()))
@@ -220,12 +324,14 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto front() noexcept(noexcept(*std::declval<D &>().begin()))
             -> decltype(*std::declval<D &>().begin())
         {
             return *derived().begin();
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto front() const
             noexcept(noexcept(*std::declval<D const &>().begin()))
                 -> decltype(*std::declval<D const &>().begin())
@@ -263,6 +369,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             typename Enable = std::enable_if_t<
                 v1_dtl::decrementable_sentinel<D>::value &&
                 v1_dtl::common_range<D>::value>>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto
         back() noexcept(noexcept(*std::prev(std::declval<D &>().end())))
             -> decltype(*std::prev(std::declval<D &>().end()))
@@ -274,6 +381,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             typename Enable = std::enable_if_t<
                 v1_dtl::decrementable_sentinel<D>::value &&
                 v1_dtl::common_range<D>::value>>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto back() const
             noexcept(noexcept(*std::prev(std::declval<D const &>().end())))
                 -> decltype(*std::prev(std::declval<D const &>().end()))
@@ -308,6 +416,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator[](typename D::size_type n) noexcept(
             noexcept(std::declval<D &>().begin()[n]))
             -> decltype(std::declval<D &>().begin()[n])
@@ -315,6 +424,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived().begin()[n];
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator[](typename D::size_type n) const
             noexcept(noexcept(std::declval<D const &>().begin()[n]))
                 -> decltype(std::declval<D const &>().begin()[n])
@@ -345,18 +455,21 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived, typename Iter = typename D::const_iterator>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr Iter begin() const
             noexcept(noexcept(std::declval<D &>().begin()))
         {
             return Iter(mutable_derived().begin());
         }
         template<typename D = Derived, typename Iter = typename D::const_iterator>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr Iter end() const noexcept(noexcept(std::declval<D &>().end()))
         {
             return Iter(mutable_derived().end());
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto cbegin() const
             noexcept(noexcept(std::declval<D const &>().begin()))
                 -> decltype(std::declval<D const &>().begin())
@@ -364,6 +477,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived().begin();
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto cend() const
             noexcept(noexcept(std::declval<D const &>().end()))
                 -> decltype(std::declval<D const &>().end())
@@ -476,6 +590,27 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived().insert(pos, il.begin(), il.end());
         }
 
+        /** Inserts elements from input iterators that are not forward
+            iterators, using `append_and_rotate()`.  A `Derived` that only
+            defines `insert(pos, first, last)` for forward iterators gets
+            single-pass insertion this way, if it has `emplace_back()`. */
+        template<
+            typename InputIterator,
+            typename D = Derived,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value &&
+                !v1_dtl::fwd_iter<InputIterator>::value>>
+        constexpr auto insert(
+            typename D::const_iterator pos,
+            InputIterator first,
+            InputIterator last)
+            -> decltype(stl_interfaces::append_and_rotate(
+                std::declval<D &>(), pos, first, last))
+        {
+            return stl_interfaces::append_and_rotate(
+                derived(), pos, first, last);
+        }
+
         template<typename D = Derived>
         constexpr auto erase(typename D::const_iterator pos) noexcept
             -> decltype(std::declval<D &>().erase(pos, std::next(pos)))
@@ -574,6 +709,81 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         {
             derived().erase(derived().begin(), derived().end());
         }
+
+        /** Resizes the container to `n` elements, for callers that will
+            overwrite any new elements before reading them.  This default
+            just calls `resize(n)`, which value-initializes the new elements;
+            a `Derived` that can leave them default-initialized instead
+            should define its own `resize_for_overwrite()`. */
+        template<typename D = Derived>
+        constexpr auto resize_for_overwrite(typename D::size_type n) noexcept(
+            noexcept(std::declval<D &>().resize(n)))
+            -> decltype((void)std::declval<D &>().resize(n))
+        {
+            derived().resize(n);
+        }
+
+        /** Appends `n` elements with `resize_for_overwrite()`, and returns
+            an iterator to the first of them. */
+        template<typename D = Derived>
+        constexpr auto append_for_overwrite(typename D::size_type n)
+            -> decltype(
+                std::declval<D &>().resize_for_overwrite(n),
+                std::declval<D &>().begin())
+        {
+            auto const old_size = derived().size();
+            derived().resize_for_overwrite(old_size + n);
+            return std::next(
+                derived().begin(),
+                typename D::difference_type(old_size));
+        }
+
+        /** Inserts the elements of `rg` before `pos`, like C++23's
+            `insert_range()`.  If `rg`'s iterators are random access and
+            `Derived` has `reserve()`, room for all the new elements is
+            reserved once, before the call to `Derived`'s `insert(pos,
+            first, last)`. */
+        template<typename R, typename D = Derived>
+        constexpr auto insert_range(typename D::const_iterator pos, R && rg)
+            -> decltype(std::declval<D &>().insert(
+                pos,
+                std::begin(std::declval<R &>()),
+                std::end(std::declval<R &>())))
+        {
+            auto const first = std::begin(rg);
+            auto const last = std::end(rg);
+            using reserve =
+                v1_dtl::reserve_range_impl<v1_dtl::range_iter_t<R>>;
+            pos = reserve::for_insert(derived(), pos, first, last);
+            return derived().insert(pos, first, last);
+        }
+
+        /** Appends the elements of `rg`, like C++23's `append_range()`.  See
+            `insert_range()`. */
+        template<typename R, typename D = Derived>
+        constexpr auto append_range(R && rg) -> decltype(
+            (void)std::declval<D &>().insert_range(
+                std::declval<D &>().end(), std::declval<R &>()))
+        {
+            derived().insert_range(derived().end(), rg);
+        }
+
+        /** Replaces the elements with those of `rg`, like C++23's
+            `assign_range()`.  If `rg`'s iterators are random access and
+            `Derived` has `reserve()`, room for all the elements is reserved
+            once, before any are assigned. */
+        template<typename R, typename D = Derived>
+        constexpr auto assign_range(R && rg)
+            -> decltype((void)std::declval<D &>().assign(
+                std::begin(std::declval<R &>()),
+                std::end(std::declval<R &>())))
+        {
+            auto const first = std::begin(rg);
+            auto const last = std::end(rg);
+            v1_dtl::reserve_range_impl<v1_dtl::range_iter_t<R>>::call(
+                derived(), first, last);
+            derived().assign(first, last);
+        }
     };
 
     /** Implementation of free function `swap()` for all containers derived
@@ -587,6 +797,38 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         return lhs.swap(rhs);
     }
 
+    /** Erases the elements `x` of `c` for which `pred(x)` is true, and
+        returns the number erased, like C++20's `std::erase_if()`.  The
+        elements are compacted in one pass with
+        `boost::stl_interfaces::remove_if()`, and then `c.erase(first, last)`
+        is called once, for the whole tail. */
+    template<typename ContainerInterface, typename Pred>
+    constexpr auto erase_if(ContainerInterface & c, Pred pred) -> decltype(
+        v1_dtl::derived_container(c),
+        c.erase(c.begin(), c.end()),
+        typename ContainerInterface::size_type())
+    {
+        auto const new_end =
+            stl_interfaces::remove_if(c.begin(), c.end(), pred);
+        auto const n = std::distance(new_end, c.end());
+        c.erase(new_end, c.end());
+        return typename ContainerInterface::size_type(n);
+    }
+
+    /** Erases the elements of `c` that are equal to `x`, and returns the
+        number erased, like C++20's `std::erase()`.  See `erase_if()`. */
+    template<typename ContainerInterface, typename T>
+    constexpr auto erase(ContainerInterface & c, T const & x) -> decltype(
+        v1_dtl::derived_container(c),
+        c.erase(c.begin(), c.end()),
+        typename ContainerInterface::size_type())
+    {
+        auto const new_end = stl_interfaces::remove(c.begin(), c.end(), x);
+        auto const n = std::distance(new_end, c.end());
+        c.erase(new_end, c.end());
+        return typename ContainerInterface::size_type(n);
+    }
+
     /** Implementation of `operator==()` for all containers derived from
         `sequence_container_interface`.  */
     template<typename ContainerInterface>
@@ -695,6 +937,10 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
         template<typename T>
         using n_iter_t =
             detail::n_iter<std::ranges::range_value_t<T>, container_size_t<T>>;
+
+        template<typename R>
+        using common_iter_t = std::ranges::iterator_t<
+            decltype(std::views::common(std::declval<R &>()))>;
     }
 
     // clang-format off
@@ -726,12 +972,15 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
     struct sequence_container_interface
     {
     private:
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr D& derived() noexcept {
         return static_cast<D&>(*this);
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr const D& derived() const noexcept {
         return static_cast<const D&>(*this);
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr D & mutable_derived() const noexcept {
         return const_cast<D&>(static_cast<const D&>(*this));
       }
@@ -741,28 +990,34 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
       { d.clear(); }
 
     public:
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr bool empty() const {
         return std::ranges::begin(derived()) == std::ranges::end(derived());
       }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto data() requires std::contiguous_iterator<std::ranges::iterator_t<D>> {
         return std::to_address(std::ranges::begin(derived()));
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto data() const requires std::contiguous_iterator<std::ranges::iterator_t<const D>> {
           return std::to_address(std::ranges::begin(derived()));
         }
 
       template<typename C = D>
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr v2_dtl::container_size_t<C> size() const
         requires std::sized_sentinel_for<std::ranges::sentinel_t<const C>, std::ranges::iterator_t<const C>> {
           return v2_dtl::container_size_t<C>(
             std::ranges::end(derived()) - std::ranges::begin(derived()));
         }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) front() {
         BOOST_ASSERT(!empty());
         return *std::ranges::begin(derived());
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) front() const {
         BOOST_ASSERT(!empty());
         return *std::ranges::begin(derived());
@@ -786,11 +1041,13 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
           return derived().erase(std::ranges::begin(derived()));
         }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) back()
         requires std::ranges::bidirectional_range<D> && std::ranges::common_range<D> {
           BOOST_ASSERT(!empty());
           return *std::ranges::prev(std::ranges::end(derived()));
         }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr decltype(auto) back() const
         requires std::ranges::bidirectional_range<const D> && std::ranges::common_range<const D> {
           BOOST_ASSERT(!empty());
@@ -817,10 +1074,12 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
           }
 
       template<std::ranges::random_access_range C = D>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr decltype(auto) operator[](v2_dtl::container_size_t<C> n) {
           return std::ranges::begin(derived())[n];
         }
       template<std::ranges::random_access_range C = const D>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr decltype(auto) operator[](v2_dtl::container_size_t<C> n) const {
           return std::ranges::begin(derived())[n];
         }
@@ -838,14 +1097,18 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
           return std::ranges::begin(derived())[n];
         }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto begin() const {
         return typename D::const_iterator(mutable_derived().begin());
       }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto end() const {
         return typename D::const_iterator(mutable_derived().end());
       }
 
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto cbegin() const { return derived().begin(); }
+      BOOST_STL_INTERFACES_FORCEINLINE
       constexpr auto cend() const { return derived().end(); }
 
       constexpr auto rbegin()
@@ -900,8 +1163,6 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
                               v2_dtl::container_size_t<C> n,
                               const std::ranges::range_value_t<C>& x)
           requires v2_dtl::range_insert<C, v2_dtl::n_iter_t<C>> {
-            auto first = detail::make_n_iter(x, n);
-            auto last = detail::make_n_iter_end(x, n);
             return derived().insert(
                 position, detail::make_n_iter(x, n), detail::make_n_iter_end(x, n));
             }
@@ -973,6 +1234,61 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
             derived().erase(std::ranges::begin(derived()), std::ranges::end(derived()));
           }
 
+      template<typename C = D>
+        constexpr void resize_for_overwrite(v2_dtl::container_size_t<C> n)
+          requires requires (D d) { d.resize(n); } {
+            derived().resize(n);
+          }
+      template<typename C = D>
+        constexpr std::ranges::iterator_t<C> append_for_overwrite(
+            v2_dtl::container_size_t<C> n)
+          requires requires (D d) { d.resize_for_overwrite(n); } {
+            auto const old_size = derived().size();
+            derived().resize_for_overwrite(old_size + n);
+            return std::ranges::next(
+                std::ranges::begin(derived()),
+                std::ranges::range_difference_t<C>(old_size));
+          }
+
+      template<std::input_iterator Iter, typename C = D>
+        requires (!std::forward_iterator<Iter>)
+        constexpr std::ranges::iterator_t<C> insert(
+            std::ranges::iterator_t<const C> pos, Iter first, Iter last)
+          requires requires (D d) { d.emplace_back(*first); } {
+            return stl_interfaces::append_and_rotate(
+              derived(), pos, first, last);
+          }
+
+      template<std::ranges::input_range R, typename C = D>
+        constexpr std::ranges::iterator_t<C> insert_range(
+            std::ranges::iterator_t<const C> pos, R&& rg)
+          requires requires (D d, v2_dtl::common_iter_t<R> it) {
+            d.insert(pos, it, it); } {
+            auto common = std::views::common(rg);
+            if constexpr (std::ranges::sized_range<R&>) {
+              pos = detail::reserve_impl<D>::for_insert(
+                derived(), pos, std::size_t(std::ranges::size(rg)));
+            }
+            return derived().insert(
+              pos, std::ranges::begin(common), std::ranges::end(common));
+          }
+      template<std::ranges::input_range R, typename C = D>
+        constexpr void append_range(R&& rg)
+          requires requires (D d) { d.insert_range(std::ranges::end(d), rg); } {
+            derived().insert_range(std::ranges::end(derived()), rg);
+          }
+      template<std::ranges::input_range R, typename C = D>
+        constexpr void assign_range(R&& rg)
+          requires requires (D d, v2_dtl::common_iter_t<R> it) {
+            d.assign(it, it); } {
+            auto common = std::views::common(rg);
+            if constexpr (std::ranges::sized_range<R&>)
+              detail::reserve_impl<D>::call(
+                derived(), std::size_t(std::ranges::size(rg)));
+            derived().assign(
+              std::ranges::begin(common), std::ranges::end(common));
+          }
+
       template<typename C = D>
         constexpr decltype(auto) operator=(
             std::initializer_list<std::ranges::range_value_t<C>> il)
@@ -985,8 +1301,31 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V2 {
         return lhs.swap(rhs);
       }
 
-      friend constexpr bool operator==(const D& lhs, const D& rhs)
-        requires std::ranges::sized_range<const D> &&
+      // The return types are deduced, since D is not yet complete here.
+      template<typename Pred>
+        friend constexpr auto erase_if(D& c, Pred pred)
+          requires requires { c.erase(std::ranges::begin(c), std::ranges::end(c)); } {
+            auto const new_end = stl_interfaces::remove_if(
+              std::ranges::begin(c), std::ranges::end(c), pred);
+            auto const n = std::ranges::distance(new_end, std::ranges::end(c));
+            c.erase(new_end, std::ranges::end(c));
+            return v2_dtl::container_size_t<D>(n);
+          }
+      template<typename T>
+        friend constexpr auto erase(D& c, const T& x)
+          requires requires { c.erase(std::ranges::begin(c), std::ranges::end(c)); } {
+            auto const new_end = stl_interfaces::remove(
+              std::ranges::begin(c), std::ranges::end(c), x);
+            auto const n = std::ranges::distance(new_end, std::ranges::end(c));
+            c.erase(new_end, std::ranges::end(c));
+            return v2_dtl::container_size_t<D>(n);
+          }
+
+      // A template, so that a non-template operator==() that D defines for
+      // itself (say, one that compares whole words) is preferred to it.
+      template<std::same_as<D> C>
+      friend constexpr bool operator==(const C& lhs, const C& rhs)
+        requires std::ranges::sized_range<const C> &&
           requires { std::ranges::equal(lhs, rhs); } {
             return lhs.size() == rhs.size() && std::ranges::equal(lhs, rhs);
           }
@@ -0,0 +1,310 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_SERIALIZATION_HPP
+#define BOOST_STL_INTERFACES_SERIALIZATION_HPP
+
+#include <boost/stl_interfaces/config.hpp>
+
+#include <boost/type_traits/is_detected.hpp>
+
+#if defined(__unix__) || defined(__APPLE__) ||                                 \
+    defined(BOOST_STL_INTERFACES_DOXYGEN)
+#define BOOST_STL_INTERFACES_POSIX_IO 1
+#include <cerrno>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#else
+#define BOOST_STL_INTERFACES_POSIX_IO 0
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces {
+
+    /** The header written in front of the elements by `write_to()`.  All
+        of it, like the elements themselves, is in the writer's native byte
+        order. */
+    struct serialization_header
+    {
+        std::uint64_t element_size;
+        std::uint64_t count;
+    };
+
+    namespace detail {
+        template<typename R>
+        using serialized_element_t = std::remove_cv_t<
+            std::remove_pointer_t<decltype(std::declval<R &>().data())>>;
+
+        template<typename R>
+        constexpr void check_serializable()
+        {
+            static_assert(
+                std::is_pointer<decltype(std::declval<R &>().data())>::value,
+                "Only ranges whose data() returns a pointer can be "
+                "serialized with write_to() or read_from().");
+            static_assert(
+                std::is_trivially_copyable<serialized_element_t<R>>::value,
+                "Only ranges of trivially copyable elements can be "
+                "serialized with write_to() or read_from().");
+        }
+
+        template<typename Container>
+        using resize_for_overwrite_expr =
+            decltype(std::declval<Container &>().resize_for_overwrite(
+                std::declval<typename Container::size_type>()));
+
+        template<
+            typename Container,
+            bool HasMember =
+                is_detected_v<resize_for_overwrite_expr, Container>>
+        struct resize_for_overwrite_impl
+        {
+            static void
+            call(Container & c, typename Container::size_type n)
+            {
+                c.resize_for_overwrite(n);
+            }
+        };
+        template<typename Container>
+        struct resize_for_overwrite_impl<Container, false>
+        {
+            static void
+            call(Container & c, typename Container::size_type n)
+            {
+                c.resize(n);
+            }
+        };
+
+        // Checks h against c's element type and capacity, and returns the
+        // number of bytes of elements that follow it, or -1 if they cannot
+        // be read into c.
+        template<typename Container>
+        std::ptrdiff_t
+        checked_payload_size(Container const & c, serialization_header h)
+        {
+            using value_type = serialized_element_t<Container const>;
+            // The count is checked against the largest byte count that fits
+            // in a std::ptrdiff_t first, so that the multiplication below
+            // cannot wrap, whatever c.max_size() is.
+            std::uint64_t const max_count =
+                std::uint64_t(PTRDIFF_MAX) / sizeof(value_type);
+            if (h.element_size != sizeof(value_type) || max_count < h.count ||
+                std::uint64_t(c.max_size()) < h.count) {
+                return -1;
+            }
+            return std::ptrdiff_t(h.count * sizeof(value_type));
+        }
+    }
+
+    /** Returns the number of bytes that `write_to(r, ...)` writes. */
+    template<typename Range>
+    std::size_t serialized_size(Range const & r) noexcept
+    {
+        detail::check_serializable<Range const>();
+        return sizeof(serialization_header) +
+               std::size_t(r.size()) *
+                   sizeof(detail::serialized_element_t<Range const>);
+    }
+
+    /** Writes a `serialization_header`, followed by the bytes of `r`'s
+        elements, to the buffer `[buf, buf + n)`.  Returns the number of
+        bytes written, or 0 if the buffer is smaller than
+        `serialized_size(r)`.
+
+        `r` may be any range with a `data()` that returns a pointer and a
+        `size()`, whose elements are trivially copyable; in particular, any
+        container or view with `element_layout::contiguous`.  The elements
+        are copied with one `memcpy()`. */
+    template<typename Range>
+    std::size_t write_to(Range const & r, void * buf, std::size_t n) noexcept
+    {
+        std::size_t const size = serialized_size(r);
+        if (n < size)
+            return 0;
+        serialization_header const h = {
+            sizeof(detail::serialized_element_t<Range const>),
+            std::uint64_t(r.size())};
+        auto out = static_cast<unsigned char *>(buf);
+        std::memcpy(out, &h, sizeof(h));
+        if (size != sizeof(h))
+            std::memcpy(out + sizeof(h), r.data(), size - sizeof(h));
+        return size;
+    }
+
+    /** Replaces the contents of `c` with the elements written by
+        `write_to()` to the front of `[buf, buf + n)`, and returns the
+        number of bytes read.  Returns 0, and leaves `c` unchanged, if the
+        buffer is too small, if the header's element size is not
+        `sizeof(value_type)`, or if the element count is greater than
+        `c.max_size()`.
+
+        `c` is resized with `resize_for_overwrite()` if it has one, and
+        `resize()` otherwise, and then the elements are copied into it with
+        one `memcpy()`. */
+    template<typename Container>
+    std::size_t
+    read_from(Container & c, void const * buf, std::size_t n) noexcept(
+        noexcept(detail::resize_for_overwrite_impl<Container>::call(c, 0)))
+    {
+        detail::check_serializable<Container>();
+        serialization_header h;
+        if (n < sizeof(h))
+            return 0;
+        auto in = static_cast<unsigned char const *>(buf);
+        std::memcpy(&h, in, sizeof(h));
+        std::ptrdiff_t const payload = detail::checked_payload_size(c, h);
+        if (payload < 0 || n - sizeof(h) < std::size_t(payload))
+            return 0;
+        detail::resize_for_overwrite_impl<Container>::call(
+            c, typename Container::size_type(h.count));
+        if (payload)
+            std::memcpy(c.data(), in + sizeof(h), std::size_t(payload));
+        return sizeof(h) + std::size_t(payload);
+    }
+
+#if BOOST_STL_INTERFACES_POSIX_IO
+
+    namespace detail {
+        // Reads exactly n bytes from fd, retrying after short reads and
+        // signals.
+        inline bool read_all(int fd, void * p, std::size_t n) noexcept
+        {
+            auto out = static_cast<unsigned char *>(p);
+            while (n) {
+                ::ssize_t const result = ::read(fd, out, n);
+                if (result < 0 && errno == EINTR)
+                    continue;
+                if (result <= 0)
+                    return false;
+                out += result;
+                n -= std::size_t(result);
+            }
+            return true;
+        }
+
+        // Returns the number of bytes between fd's offset and the end of
+        // the file, or -1 if fd is not a regular file, so that its size
+        // says nothing about how much can still be read from it.
+        inline std::ptrdiff_t remaining_bytes(int fd) noexcept
+        {
+            struct ::stat st;
+            if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+                return -1;
+            ::off_t const pos = ::lseek(fd, 0, SEEK_CUR);
+            if (pos < 0)
+                return -1;
+            return pos < st.st_size ? std::ptrdiff_t(st.st_size - pos) : 0;
+        }
+
+        // The most bytes of elements that read_from(c, fd) makes room for
+        // in c before reading them, when it cannot tell how many fd has.
+        constexpr std::size_t max_unread_bytes = 1 << 16;
+    }
+
+    /** Writes a `serialization_header`, followed by the bytes of `r`'s
+        elements, to the file descriptor `fd`.  Returns the number of bytes
+        written, or 0 on a write error; `errno` then says what went wrong.
+
+        The header and the elements are written with a single `writev()`,
+        which is only repeated if the system writes less than all of it.
+        This overload is only available on POSIX systems. */
+    template<typename Range>
+    std::size_t write_to(Range const & r, int fd) noexcept
+    {
+        std::size_t const size = serialized_size(r);
+        serialization_header const h = {
+            sizeof(detail::serialized_element_t<Range const>),
+            std::uint64_t(r.size())};
+        ::iovec iov[2] = {
+            {const_cast<serialization_header *>(&h), sizeof(h)},
+            {const_cast<void *>(static_cast<void const *>(r.data())),
+             size - sizeof(h)}};
+        ::iovec * first = iov;
+        int count = iov[1].iov_len ? 2 : 1;
+        while (count) {
+            ::ssize_t result = ::writev(fd, first, count);
+            if (result < 0 && errno == EINTR)
+                continue;
+            if (result < 0)
+                return 0;
+            for (; count && first->iov_len <= std::size_t(result);
+                 ++first, --count) {
+                result -= ::ssize_t(first->iov_len);
+            }
+            if (count) {
+                first->iov_base = static_cast<char *>(first->iov_base) + result;
+                first->iov_len -= std::size_t(result);
+            }
+        }
+        return size;
+    }
+
+    /** Replaces the contents of `c` with the elements written by
+        `write_to()` to the file descriptor `fd`, and returns the number of
+        bytes read.  Returns 0 if a read fails or reaches the end of the
+        file early, if the header's element size is not `sizeof(value_type)`,
+        or if the element count is greater than `c.max_size()`.  If the
+        header cannot be used, `c` is left unchanged; if the elements cannot
+        be read, `c` holds an unspecified number of unspecified values.
+
+        The element count in the header is not trusted.  If `fd` is a
+        regular file, and fewer bytes than the count calls for remain after
+        the header, this returns 0 and leaves `c` unchanged, without
+        resizing it.  Otherwise, `c` is grown at most 64 KiB of elements at
+        a time, ahead of the bytes actually read, so a corrupt count from a
+        pipe or socket fails when the data runs out, instead of making `c`
+        allocate for elements that never arrive.
+
+        For a regular file, the header and the elements are each read with
+        one `read()`, which is only repeated if the system reads less than
+        all of it.  This overload is only available on POSIX systems. */
+    template<typename Container>
+    std::size_t read_from(Container & c, int fd) noexcept(
+        noexcept(detail::resize_for_overwrite_impl<Container>::call(c, 0)))
+    {
+        detail::check_serializable<Container>();
+        using size_type = typename Container::size_type;
+        using value_type = detail::serialized_element_t<Container>;
+        serialization_header h;
+        if (!detail::read_all(fd, &h, sizeof(h)))
+            return 0;
+        std::ptrdiff_t const payload = detail::checked_payload_size(c, h);
+        if (payload < 0)
+            return 0;
+        std::ptrdiff_t const available = detail::remaining_bytes(fd);
+        if (0 <= available && available < payload)
+            return 0;
+        size_type const count = size_type(h.count);
+        size_type step = count;
+        if (available < 0) {
+            step = size_type((std::max)(
+                detail::max_unread_bytes / sizeof(value_type), std::size_t(1)));
+        }
+        size_type n = 0;
+        do {
+            size_type const next = n + (std::min)(step, size_type(count - n));
+            detail::resize_for_overwrite_impl<Container>::call(c, next);
+            std::size_t const bytes =
+                std::size_t(next - n) * sizeof(value_type);
+            if (bytes && !detail::read_all(fd, c.data() + n, bytes))
+                return 0;
+            n = next;
+        } while (n < count);
+        return sizeof(h) + std::size_t(payload);
+    }
+
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,392 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_STATIC_VECTOR_HPP
+#define BOOST_STL_INTERFACES_STATIC_VECTOR_HPP
+
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+// static_vector is usable in constant expressions when the language and
+// library support constexpr destructors, std::construct_at(), and constexpr
+// algorithms (that is, in C++20 and later).
+#if defined(__cpp_lib_constexpr_dynamic_alloc) &&                              \
+    defined(__cpp_lib_constexpr_algorithms) &&                                 \
+    defined(__cpp_lib_is_constant_evaluated) &&                                \
+    defined(__cpp_constexpr_dynamic_alloc)
+#define BOOST_STL_INTERFACES_CONSTEXPR_STATIC_VECTOR 1
+#define BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR constexpr
+#else
+#define BOOST_STL_INTERFACES_CONSTEXPR_STATIC_VECTOR 0
+#define BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR
+#endif
+
+// Elements that are not trivial are created with std::construct_at() inside
+// an array in a union, before any member of the union is active.  Not every
+// compiler accepts that during constant evaluation (Clang has rejected it),
+// so constexpr use with such elements is only claimed for GCC.
+#if BOOST_STL_INTERFACES_CONSTEXPR_STATIC_VECTOR && defined(__GNUC__) &&       \
+    !defined(__clang__)
+#define BOOST_STL_INTERFACES_CONSTEXPR_NONTRIVIAL_STATIC_VECTOR 1
+#else
+#define BOOST_STL_INTERFACES_CONSTEXPR_NONTRIVIAL_STATIC_VECTOR 0
+#endif
+
+
+namespace boost { namespace stl_interfaces {
+
+    namespace detail {
+        template<typename T, typename... Args>
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        construct_at(T * p, Args &&... args)
+        {
+#if BOOST_STL_INTERFACES_CONSTEXPR_STATIC_VECTOR
+            std::construct_at(p, (Args &&) args...);
+#else
+            ::new (static_cast<void *>(p)) T((Args &&) args...);
+#endif
+        }
+
+        template<typename T>
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        destroy(T * first, T * last) noexcept
+        {
+            if (std::is_trivially_destructible<T>::value)
+                return;
+            for (; first != last; ++first) {
+                first->~T();
+            }
+        }
+    }
+
+    /** A fixed-capacity vector, which keeps its elements in an array inside
+        the object, instead of on the heap.  It has the same interface as
+        `std::vector`, except for the allocator-related parts; inserting
+        more than `N` elements is a precondition violation.
+
+        In C++20 and later, every member, including everything provided by
+        `sequence_container_interface`, is `constexpr`.  A `static_vector`
+        can be built and returned by a `constexpr` function.  If `T` is
+        trivially default constructible and trivially destructible, the
+        result can also be stored in a `constexpr` variable, so tables
+        that would otherwise be computed at startup can be computed at
+        compile time. */
+    template<typename T, std::size_t N>
+    struct static_vector : sequence_container_interface<
+                               static_vector<T, N>,
+                               element_layout::contiguous>
+    {
+        static_assert(0 < N, "static_vector must have a nonzero capacity.");
+
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = T const *;
+        using reference = value_type &;
+        using const_reference = value_type const &;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = T *;
+        using const_iterator = T const *;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+
+        // construct/copy/destroy
+
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR static_vector() noexcept
+        {
+            start_lifetimes();
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR explicit static_vector(
+            size_type n)
+        {
+            start_lifetimes();
+            resize(n);
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR explicit static_vector(
+            size_type n, T const & x)
+        {
+            start_lifetimes();
+            resize(n, x);
+        }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<InputIterator>::iterator_category,
+                std::input_iterator_tag>::value>>
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR
+        static_vector(InputIterator first, InputIterator last)
+        {
+            start_lifetimes();
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR
+        static_vector(std::initializer_list<T> il) :
+            static_vector(il.begin(), il.end())
+        {}
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR
+        static_vector(static_vector const & other) :
+            static_vector(other.begin(), other.end())
+        {}
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR
+        static_vector(static_vector && other) noexcept(
+            std::is_nothrow_move_constructible<T>::value)
+        {
+            start_lifetimes();
+            for (auto & element : other) {
+                emplace_back(std::move(element));
+            }
+            other.clear();
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR static_vector &
+        operator=(static_vector const & other)
+        {
+            if (this != &other) {
+                clear();
+                for (auto const & element : other) {
+                    emplace_back(element);
+                }
+            }
+            return *this;
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR static_vector &
+        operator=(static_vector && other) noexcept(
+            std::is_nothrow_move_constructible<T>::value)
+        {
+            if (this != &other) {
+                clear();
+                for (auto & element : other) {
+                    emplace_back(std::move(element));
+                }
+                other.clear();
+            }
+            return *this;
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR ~static_vector()
+        {
+            clear();
+        }
+
+        // iterators
+
+        BOOST_STL_INTERFACES_FORCEINLINE
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR iterator begin() noexcept
+        {
+            return storage_.elements_;
+        }
+        BOOST_STL_INTERFACES_FORCEINLINE
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR iterator end() noexcept
+        {
+            return storage_.elements_ + size_;
+        }
+
+        // capacity
+
+        static constexpr size_type max_size() noexcept { return N; }
+        static constexpr size_type capacity() noexcept { return N; }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void resize(size_type sz)
+        {
+            resize_impl(sz, [this] { detail::construct_at(end()); });
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        resize(size_type sz, T const & x)
+        {
+            resize_impl(sz, [&] { detail::construct_at(end(), x); });
+        }
+        /** Like `resize()`, except that new elements are
+            default-initialized, rather than value-initialized, so elements
+            of trivial types are left for the caller to overwrite.  During
+            constant evaluation they are value-initialized instead, since
+            reading them would not otherwise be allowed. */
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        resize_for_overwrite(size_type sz)
+        {
+#if BOOST_STL_INTERFACES_CONSTEXPR_STATIC_VECTOR
+            if (std::is_constant_evaluated()) {
+                resize(sz);
+                return;
+            }
+#endif
+            resize_impl(sz, [this] {
+                ::new (static_cast<void *>(std::addressof(*end()))) T;
+            });
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        reserve(size_type n) noexcept
+        {
+            BOOST_ASSERT(n <= N);
+            (void)n;
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        shrink_to_fit() noexcept
+        {}
+
+        // modifiers
+
+        template<typename... Args>
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR reference
+        emplace_back(Args &&... args)
+        {
+            BOOST_ASSERT(size_ < N);
+            detail::construct_at(end(), (Args &&) args...);
+            ++size_;
+            return this->back();
+        }
+        template<typename... Args>
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR iterator
+        emplace(const_iterator pos, Args &&... args)
+        {
+            auto const position = begin() + (pos - storage_.elements_);
+            if (position == end()) {
+                emplace_back((Args &&) args...);
+                return position;
+            }
+            T x((Args &&) args...);
+            auto const last = end();
+            emplace_back(std::move(this->back()));
+            std::move_backward(position, last - 1, last);
+            *position = std::move(x);
+            return position;
+        }
+        template<
+            typename ForwardIterator,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<
+                    ForwardIterator>::iterator_category,
+                std::forward_iterator_tag>::value>>
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR iterator insert(
+            const_iterator pos, ForwardIterator first, ForwardIterator last)
+        {
+            auto const position = begin() + (pos - storage_.elements_);
+            auto const n = size_type(std::distance(first, last));
+            BOOST_ASSERT(size_ + n <= N);
+            auto const old_end = end();
+            auto const tail = size_type(old_end - position);
+            if (n <= tail) {
+                for (auto it = old_end - n; it != old_end; ++it) {
+                    emplace_back(std::move(*it));
+                }
+                std::move_backward(position, old_end - n, old_end);
+                std::copy(first, last, position);
+            } else {
+                auto const mid = std::next(first, tail);
+                for (auto it = mid; it != last; ++it) {
+                    emplace_back(*it);
+                }
+                for (auto it = position; it != old_end; ++it) {
+                    emplace_back(std::move(*it));
+                }
+                std::copy(first, mid, position);
+            }
+            return position;
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR iterator
+        erase(const_iterator f, const_iterator l)
+        {
+            auto const first = begin() + (f - storage_.elements_);
+            auto const last = begin() + (l - storage_.elements_);
+            auto const old_end = end();
+            auto const new_end = std::move(last, old_end, first);
+            detail::destroy(new_end, old_end);
+            size_ -= size_type(last - first);
+            return first;
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        swap(static_vector & other)
+        {
+            static_vector * shorter = this;
+            static_vector * longer = &other;
+            if (longer->size_ < shorter->size_)
+                std::swap(shorter, longer);
+            auto const short_size = shorter->size_;
+            std::swap_ranges(
+                shorter->begin(), shorter->end(), longer->begin());
+            for (auto it = longer->begin() + short_size, last = longer->end();
+                 it != last;
+                 ++it) {
+                shorter->emplace_back(std::move(*it));
+            }
+            longer->erase(longer->begin() + short_size, longer->end());
+        }
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void clear() noexcept
+        {
+            detail::destroy(begin(), end());
+            size_ = 0;
+        }
+
+        using base_type = sequence_container_interface<
+            static_vector<T, N>,
+            element_layout::contiguous>;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::insert;
+        using base_type::erase;
+
+    private:
+        // During constant evaluation, every element of the array must be
+        // initialized for the vector to be stored in a constexpr variable.
+        // For trivial types, that costs nothing at run time, since it is
+        // only done at compile time.  The elements are assigned rather than
+        // constructed, because a trivial assignment to an element is what
+        // makes elements_ the active member of storage_ (P1330); creating
+        // an object inside a member that is not yet active is not accepted
+        // by every compiler.
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        start_lifetimes() noexcept
+        {
+#if BOOST_STL_INTERFACES_CONSTEXPR_STATIC_VECTOR
+            if constexpr (
+                std::is_trivially_default_constructible_v<T> &&
+                std::is_trivially_move_assignable_v<T> &&
+                std::is_trivially_destructible_v<T>) {
+                if (std::is_constant_evaluated()) {
+                    for (size_type i = 0; i < N; ++i) {
+                        storage_.elements_[i] = T();
+                    }
+                }
+            }
+#endif
+        }
+
+        template<typename F>
+        BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR void
+        resize_impl(size_type sz, F construct)
+        {
+            BOOST_ASSERT(sz <= N);
+            if (sz < size_)
+                erase(begin() + sz, end());
+            while (size_ < sz) {
+                construct();
+                ++size_;
+            }
+        }
+
+        union storage
+        {
+            BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR storage() noexcept {}
+            BOOST_STL_INTERFACES_STATIC_VECTOR_CONSTEXPR ~storage() {}
+            T elements_[N];
+        };
+
+        storage storage_;
+        size_type size_ = 0;
+    };
+
+}}
+
+#endif
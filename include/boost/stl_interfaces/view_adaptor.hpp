@@ -62,6 +62,39 @@ namespace boost { namespace stl_interfaces {
         constexpr bool is_invocable_v =
             is_detected_v<invocable_expr, F, Args...>;
 
+        template<typename F, typename... Args>
+        using simplify_expr =
+            decltype(std::declval<F>().simplify(std::declval<Args>()...));
+        template<typename F, typename... Args>
+        constexpr bool can_simplify_v =
+            is_detected_v<simplify_expr, F, Args...>;
+
+        template<bool Simplify>
+        struct simplify_or_invoke
+        {
+            template<typename F, typename... Args>
+            static constexpr decltype(auto) call(F && f, Args &&... args)
+            {
+                return ((F &&) f).simplify((Args &&) args...);
+            }
+        };
+        template<>
+        struct simplify_or_invoke<false>
+        {
+            template<typename F, typename... Args>
+            static constexpr decltype(auto) call(F && f, Args &&... args)
+            {
+                return ((F &&) f)((Args &&) args...);
+            }
+        };
+
+        template<typename F, typename... Args>
+        constexpr decltype(auto) simplify_or_call(F && f, Args &&... args)
+        {
+            return simplify_or_invoke<can_simplify_v<F, Args...>>::call(
+                (F &&) f, (Args &&) args...);
+        }
+
         template<typename Func, typename... CapturedArgs>
         struct bind_back_t
         {
@@ -104,9 +137,41 @@ namespace boost { namespace stl_interfaces {
                     std::move(*this), indices(), (Args &&) args...);
             }
 
+            // These forward to f.simplify(args..., bound_args...), so that a
+            // closure made by adaptor can simplify, if the adaptor's
+            // function can.
+            template<typename... Args, typename F = Func>
+            constexpr auto simplify(Args &&... args) const & -> decltype(
+                std::declval<F const &>().simplify(
+                    std::declval<Args>()...,
+                    std::declval<CapturedArgs const &>()...))
+            {
+                return simplify_impl(*this, indices(), (Args &&) args...);
+            }
+
+            template<typename... Args, typename F = Func>
+            constexpr auto simplify(Args &&... args) && -> decltype(
+                std::declval<F &&>().simplify(
+                    std::declval<Args>()...,
+                    std::declval<CapturedArgs &&>()...))
+            {
+                return simplify_impl(
+                    std::move(*this), indices(), (Args &&) args...);
+            }
+
         private:
             using indices = std::index_sequence_for<CapturedArgs...>;
 
+            template<typename T, size_t... I, typename... Args>
+            static constexpr decltype(auto) simplify_impl(
+                T && this_, std::index_sequence<I...>, Args &&... args)
+            {
+                return ((T &&) this_)
+                    .f_.simplify(
+                        (Args &&) args...,
+                        std::get<I>(((T &&) this_).bound_args_)...);
+            }
+
             template<typename T, size_t... I, typename... Args>
             static constexpr decltype(auto)
             call_impl(T && this_, std::index_sequence<I...>, Args &&... args)
@@ -237,7 +302,11 @@ namespace boost { namespace stl_interfaces {
     /** An invocable consisting of a contained invocable `f`.  Calling
         `operator()` with some argument `t` calls `f(t)` and returns the
         result.  This type is typically used to capture a the result of a call
-        to `bind_back()`. */
+        to `bind_back()`.
+
+        If `f.simplify(t)` is well-formed, `operator()` returns that instead.
+        This lets an adaptor replace a nested view with a simpler equivalent,
+        e.g. `reverse(reverse(v))` with `v`. */
     template<typename F>
     struct closure : range_adaptor_closure<closure<F>>
     {
@@ -254,7 +323,7 @@ namespace boost { namespace stl_interfaces {
 #endif
         constexpr decltype(auto) operator()(T && t) const &
         {
-            return f_((T &&) t);
+            return detail::simplify_or_call(f_, (T &&) t);
         }
 
 #if BOOST_STL_INTERFACES_USE_CONCEPTS
@@ -267,7 +336,7 @@ namespace boost { namespace stl_interfaces {
 #endif
         constexpr decltype(auto) operator()(T && t) &&
         {
-            return std::move(f_)((T &&) t);
+            return detail::simplify_or_call(std::move(f_), (T &&) t);
         }
 
     private:
@@ -282,7 +351,7 @@ namespace boost { namespace stl_interfaces {
         {
             static constexpr decltype(auto) call(F const & f, Args &&... args)
             {
-                return f((Args &&) args...);
+                return simplify_or_call(f, (Args &&) args...);
             }
         };
 
@@ -305,7 +374,11 @@ namespace boost { namespace stl_interfaces {
     /** Adapts an invocable `f` as a view adaptor.  Calling
         `operator(args...)` will either: call `f(args...)` and return the
         result, if `f(args...)` is well-formed; or return
-        `closure(stl_interfaces::bind_back(f, args...))` otherwise. */
+        `closure(stl_interfaces::bind_back(f, args...))` otherwise.
+
+        As with `closure`, `f.simplify(args...)` is used in place of
+        `f(args...)` when it is well-formed, both here and in the returned
+        `closure`. */
     template<typename F>
     struct adaptor
     {
@@ -318,7 +391,7 @@ namespace boost { namespace stl_interfaces {
         {
 #if BOOST_STL_INTERFACES_USE_CONCEPTS
             if constexpr (std::is_invocable_v<F const &, Args...>) {
-                return f_((Args &&) args...);
+                return detail::simplify_or_call(f_, (Args &&) args...);
             } else {
                 return closure(
                     stl_interfaces::bind_back(f_, (Args &&) args...));
@@ -50,10 +50,12 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
     {
 #ifndef BOOST_STL_INTERFACES_DOXYGEN
     private:
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr Derived & derived() noexcept
         {
             return static_cast<Derived &>(*this);
         }
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr const Derived & derived() const noexcept
         {
             return static_cast<Derived const &>(*this);
@@ -62,6 +64,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
 
     public:
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto empty() noexcept(
             noexcept(std::declval<D &>().begin() == std::declval<D &>().end()))
             -> decltype(
@@ -70,6 +73,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived().begin() == derived().end();
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto empty() const noexcept(noexcept(
             std::declval<D const &>().begin() ==
             std::declval<D const &>().end()))
@@ -101,6 +105,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             typename D = Derived,
             element_layout C = Contiguity,
             typename Enable = std::enable_if_t<C == element_layout::contiguous>>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto data() noexcept(noexcept(std::declval<D &>().begin()))
             -> decltype(std::addressof(*std::declval<D &>().begin()))
         {
@@ -110,6 +115,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             typename D = Derived,
             element_layout C = Contiguity,
             typename Enable = std::enable_if_t<C == element_layout::contiguous>>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto data() const
             noexcept(noexcept(std::declval<D const &>().begin()))
                 -> decltype(std::addressof(*std::declval<D const &>().begin()))
@@ -118,6 +124,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto size() noexcept(
             noexcept(std::declval<D &>().end() - std::declval<D &>().begin()))
             -> decltype(std::declval<D &>().end() - std::declval<D &>().begin())
@@ -125,6 +132,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived().end() - derived().begin();
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto size() const noexcept(noexcept(
             std::declval<D const &>().end() -
             std::declval<D const &>().begin()))
@@ -173,6 +181,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
         }
 
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator[](v1_dtl::range_difference_t<D> n) noexcept(
             noexcept(std::declval<D &>().begin()[n]))
             -> decltype(std::declval<D &>().begin()[n])
@@ -180,6 +189,7 @@ namespace boost { namespace stl_interfaces { BOOST_STL_INTERFACES_NAMESPACE_V1 {
             return derived().begin()[n];
         }
         template<typename D = Derived>
+        BOOST_STL_INTERFACES_FORCEINLINE
         constexpr auto operator[](v1_dtl::range_difference_t<D> n) const
             noexcept(noexcept(std::declval<D const &>().begin()[n]))
                 -> decltype(std::declval<D const &>().begin()[n])
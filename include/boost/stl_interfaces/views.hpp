@@ -0,0 +1,1321 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_VIEWS_HPP
+#define BOOST_STL_INTERFACES_VIEWS_HPP
+
+#include <boost/stl_interfaces/generating_iterators.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/reverse_iterator.hpp>
+#include <boost/stl_interfaces/view_adaptor.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <boost/type_traits/is_detected.hpp>
+
+#if 202002L <= __cplusplus && defined(__has_include)
+#if __has_include(<bit>)
+#include <bit>
+#endif
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces {
+    namespace detail {
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R>
+        using range_iterator_t = std::ranges::iterator_t<R>;
+        template<typename R>
+        using range_sentinel_t = std::ranges::sentinel_t<R>;
+#else
+        template<typename R>
+        using range_iterator_t = decltype(std::declval<R &>().begin());
+        template<typename R>
+        using range_sentinel_t = decltype(std::declval<R &>().end());
+#endif
+        template<typename R>
+        using range_difference_t = typename std::iterator_traits<
+            range_iterator_t<R>>::difference_type;
+
+        template<typename Iter, typename Sentinel>
+        using sentinel_sub_expr = decltype(
+            std::declval<Sentinel const &>() - std::declval<Iter const &>());
+
+        // True iff [begin(), end()) can be cut short in O(1) without
+        // changing the iterator type.
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R>
+        constexpr bool sized_random_access_v =
+            std::random_access_iterator<range_iterator_t<R>> &&
+            std::sized_sentinel_for<range_sentinel_t<R>, range_iterator_t<R>>;
+#else
+        template<typename R>
+        constexpr bool sized_random_access_v =
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                typename std::iterator_traits<
+                    range_iterator_t<R>>::iterator_category>::value &&
+            is_detected_v<
+                sentinel_sub_expr,
+                range_iterator_t<R>,
+                range_sentinel_t<R>>;
+#endif
+
+        template<typename T>
+        struct enable_borrowed : std::false_type
+        {};
+
+        template<typename R>
+        using range_size_expr = decltype(std::declval<R &>().size());
+        template<typename R>
+        using range_data_expr = decltype(std::declval<R &>().data());
+
+        template<typename R>
+        constexpr element_layout range_layout_v =
+            std::is_pointer<range_iterator_t<R>>::value
+                ? element_layout::contiguous
+                : element_layout::discontiguous;
+    }
+
+    /** A view of all the elements of an lvalue range `R`.  `ref_view` just
+        refers to the range, so it is cheap to copy, and must not outlive the
+        range. */
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<typename R>
+    requires std::is_object_v<R>
+#else
+    template<
+        typename R,
+        typename Enable = std::enable_if_t<std::is_object<R>::value>>
+#endif
+    struct ref_view
+        : view_interface<ref_view<R>, detail::range_layout_v<R>>
+    {
+        constexpr ref_view(R & r) noexcept : r_(std::addressof(r)) {}
+
+        constexpr auto begin() const { return r_->begin(); }
+        constexpr auto end() const { return r_->end(); }
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R2 = R>
+        requires requires(R2 & r) { r.size(); }
+#else
+        template<
+            typename R2 = R,
+            typename E = std::enable_if_t<
+                is_detected_v<detail::range_size_expr, R2>>>
+#endif
+        constexpr auto size() const
+        {
+            return r_->size();
+        }
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R2 = R>
+        requires requires(R2 & r) { r.data(); }
+#else
+        template<
+            typename R2 = R,
+            typename E = std::enable_if_t<
+                is_detected_v<detail::range_data_expr, R2>>>
+#endif
+        constexpr auto data() const
+        {
+            return r_->data();
+        }
+
+        /** Returns the range this view refers to. */
+        constexpr R & base() const { return *r_; }
+
+    private:
+        R * r_;
+    };
+
+    /** A view that owns the rvalue range `R` it is made from.  The range is
+        moved in exactly once; `owning_view` is move-only, so it is never
+        copied after that. */
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<std::movable R>
+    requires std::is_object_v<R>
+#else
+    template<
+        typename R,
+        typename Enable = std::enable_if_t<std::is_object<R>::value>>
+#endif
+    struct owning_view
+        : view_interface<owning_view<R>, detail::range_layout_v<R>>
+    {
+        owning_view() = default;
+        constexpr owning_view(R && r) : r_(std::move(r)) {}
+
+        owning_view(owning_view &&) = default;
+        owning_view & operator=(owning_view &&) = default;
+        owning_view(owning_view const &) = delete;
+        owning_view & operator=(owning_view const &) = delete;
+
+        constexpr auto begin() { return r_.begin(); }
+        constexpr auto end() { return r_.end(); }
+        constexpr auto begin() const { return r_.begin(); }
+        constexpr auto end() const { return r_.end(); }
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R2 = R>
+        requires requires(R2 & r) { r.size(); }
+#else
+        template<
+            typename R2 = R,
+            typename E = std::enable_if_t<
+                is_detected_v<detail::range_size_expr, R2>>>
+#endif
+        constexpr auto size() const
+        {
+            return r_.size();
+        }
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R2 = R>
+        requires requires(R2 & r) { r.data(); }
+#else
+        template<
+            typename R2 = R,
+            typename E = std::enable_if_t<
+                is_detected_v<detail::range_data_expr, R2>>>
+#endif
+        constexpr auto data()
+        {
+            return r_.data();
+        }
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R2 = R const>
+        requires requires(R2 & r) { r.data(); }
+#else
+        template<
+            typename R2 = R const,
+            typename E = std::enable_if_t<
+                is_detected_v<detail::range_data_expr, R2>>>
+#endif
+        constexpr auto data() const
+        {
+            return r_.data();
+        }
+
+        /** Returns the range this view owns. */
+        constexpr R & base() & noexcept { return r_; }
+        /** Returns the range this view owns. */
+        constexpr R const & base() const & noexcept { return r_; }
+        /** Returns the range this view owns. */
+        constexpr R && base() && noexcept { return std::move(r_); }
+
+    private:
+        R r_ = R();
+    };
+
+    namespace detail {
+        template<typename R>
+        struct enable_borrowed<ref_view<R>> : std::true_type
+        {};
+        template<typename R>
+        struct enable_borrowed<owning_view<R>> : enable_borrowed<R>
+        {};
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename T>
+        constexpr bool is_view_v = std::ranges::view<T>;
+#else
+        template<typename T, bool IsClass = std::is_class<T>::value>
+        struct is_view
+            : std::integral_constant<
+                  bool,
+                  std::is_base_of<
+                      view_interface<T, element_layout::discontiguous>,
+                      T>::value ||
+                      std::is_base_of<
+                          view_interface<T, element_layout::contiguous>,
+                          T>::value>
+        {};
+        template<typename T>
+        struct is_view<T, false> : std::false_type
+        {};
+        template<typename T>
+        constexpr bool is_view_v = is_view<T>::value;
+#endif
+
+        // 0: a view, which is copied or moved; 1: an lvalue, which is
+        // referred to; 2: an rvalue, which is moved into an owning_view.
+        template<typename R>
+        using all_kind = std::integral_constant<
+            int,
+            is_view_v<remove_cvref_t<R>>
+                ? 0
+                : (std::is_lvalue_reference<R>::value ? 1 : 2)>;
+
+        template<int Kind>
+        struct all_impl_impl
+        {
+            template<typename R>
+            static constexpr auto call(R && r)
+            {
+                return remove_cvref_t<R>((R &&) r);
+            }
+        };
+        template<>
+        struct all_impl_impl<1>
+        {
+            template<typename R>
+            static constexpr auto call(R & r)
+            {
+                return ref_view<R>(r);
+            }
+        };
+        template<>
+        struct all_impl_impl<2>
+        {
+            template<typename R>
+            static constexpr auto call(R && r)
+            {
+                return owning_view<R>(std::move(r));
+            }
+        };
+
+        struct all_impl
+        {
+            // Const rvalues that are not views are rejected, since they can
+            // be neither referred to safely nor moved from.
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            template<std::ranges::range R>
+            requires(all_kind<R>::value != 2 ||
+                     !std::is_const_v<std::remove_reference_t<R>>)
+#else
+            template<
+                typename R,
+                typename Enable = std::enable_if_t<
+                    is_detected_v<range_iterator_t, R> &&
+                    (all_kind<R>::value != 2 ||
+                     !std::is_const<std::remove_reference_t<R>>::value)>>
+#endif
+            constexpr auto operator()(R && r) const
+            {
+                return all_impl_impl<all_kind<R>::value>::call((R &&) r);
+            }
+        };
+    }
+
+    namespace views {
+        /** A view adaptor that produces a view of all the elements of a
+            range `r`, as in `all(r)` or `r | all`.
+
+            If `r` is already a view, the result is a copy of `r` (so
+            `all(all(r))` is just `all(r)`).  Otherwise, if `r` is an
+            lvalue, the result is a `ref_view` that refers to it, and if `r`
+            is an rvalue, it is moved into an `owning_view`; the range is
+            never copied. */
+#if defined(__cpp_inline_variables) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+        inline constexpr closure<detail::all_impl> all = detail::all_impl{};
+#else
+        namespace {
+            constexpr closure<detail::all_impl> all{detail::all_impl{}};
+        }
+#endif
+
+        /** The type of view that `all` produces from a range of type `R`. */
+        template<typename R>
+        using all_t = decltype(all(std::declval<R>()));
+    }
+
+    namespace detail {
+        // Selects the constructors of take_view and reverse_view that
+        // initialize their view member directly from views::all(r), so that
+        // an rvalue range is moved only once, into the owning_view.
+        struct all_tag
+        {};
+    }
+
+    /** A view of the elements in `[first, last)`.  `subrange` keeps the
+        iterator and sentinel types of the range it is made from, so
+        algorithms that have fast paths for those types still use them. */
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<std::input_or_output_iterator Iter, typename Sentinel = Iter>
+    requires std::sentinel_for<Sentinel, Iter>
+#else
+    template<typename Iter, typename Sentinel = Iter>
+#endif
+    struct subrange
+        : view_interface<
+              subrange<Iter, Sentinel>,
+              std::is_pointer<Iter>::value ? element_layout::contiguous
+                                           : element_layout::discontiguous>
+    {
+        constexpr subrange() = default;
+        constexpr subrange(Iter first, Sentinel last) :
+            first_(std::move(first)), last_(std::move(last))
+        {}
+
+        constexpr Iter begin() const { return first_; }
+        constexpr Sentinel end() const { return last_; }
+
+    private:
+        Iter first_ = Iter();
+        Sentinel last_ = Sentinel();
+    };
+
+    namespace detail {
+        template<typename Iter, typename Sentinel>
+        struct enable_borrowed<subrange<Iter, Sentinel>> : std::true_type
+        {};
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R>
+        constexpr bool borrowed_range_v = std::ranges::borrowed_range<R>;
+#else
+        template<typename R>
+        constexpr bool borrowed_range_v =
+            std::is_lvalue_reference<R>::value ||
+            enable_borrowed<remove_cvref_t<R>>::value;
+#endif
+
+        template<typename Iter>
+        using take_iterator_concept = std::conditional_t<
+            std::is_base_of<
+                std::bidirectional_iterator_tag,
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+                v2::v2_dtl::iter_concept_t<Iter>>::value,
+#else
+                typename std::iterator_traits<Iter>::iterator_category>::value,
+#endif
+            std::bidirectional_iterator_tag,
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            v2::v2_dtl::iter_concept_t<Iter>>;
+#else
+            typename std::iterator_traits<Iter>::iterator_category>;
+#endif
+
+        // Wraps Iter, counting down from n to zero as it is incremented.
+        // This is only used when Iter cannot simply be advanced by n.
+        template<typename Iter>
+        struct take_iterator
+            : iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                  take_iterator<Iter>,
+#endif
+                  take_iterator_concept<Iter>,
+                  typename std::iterator_traits<Iter>::value_type,
+                  typename std::iterator_traits<Iter>::reference,
+                  typename std::iterator_traits<Iter>::pointer,
+                  typename std::iterator_traits<Iter>::difference_type>
+        {
+            using count_type =
+                typename std::iterator_traits<Iter>::difference_type;
+
+            constexpr take_iterator() = default;
+            constexpr take_iterator(Iter it, count_type n) :
+                it_(std::move(it)), n_(n)
+            {}
+
+            constexpr Iter base() const { return it_; }
+            constexpr count_type count() const { return n_; }
+
+            constexpr take_iterator & operator++()
+            {
+                ++it_;
+                --n_;
+                return *this;
+            }
+            constexpr take_iterator & operator--()
+            {
+                --it_;
+                ++n_;
+                return *this;
+            }
+
+            using base_type = iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                take_iterator<Iter>,
+#endif
+                take_iterator_concept<Iter>,
+                typename std::iterator_traits<Iter>::value_type,
+                typename std::iterator_traits<Iter>::reference,
+                typename std::iterator_traits<Iter>::pointer,
+                typename std::iterator_traits<Iter>::difference_type>;
+            using base_type::operator++;
+            using base_type::operator--;
+
+        private:
+            friend access;
+            constexpr Iter & base_reference() { return it_; }
+            constexpr Iter const & base_reference() const { return it_; }
+
+            Iter it_ = Iter();
+            count_type n_ = 0;
+        };
+
+        template<typename Sentinel>
+        struct take_sentinel
+        {
+            constexpr take_sentinel() = default;
+            constexpr explicit take_sentinel(Sentinel s) : s_(std::move(s))
+            {}
+
+            template<typename Iter>
+            friend constexpr bool
+            operator==(take_iterator<Iter> const & it, take_sentinel const & s)
+            {
+                return !it.count() || it.base() == s.s_;
+            }
+            template<typename Iter>
+            friend constexpr bool
+            operator!=(take_iterator<Iter> const & it, take_sentinel const & s)
+            {
+                return !(it == s);
+            }
+#if !BOOST_STL_INTERFACES_USE_CONCEPTS
+            template<typename Iter>
+            friend constexpr bool
+            operator==(take_sentinel const & s, take_iterator<Iter> const & it)
+            {
+                return it == s;
+            }
+            template<typename Iter>
+            friend constexpr bool
+            operator!=(take_sentinel const & s, take_iterator<Iter> const & it)
+            {
+                return !(it == s);
+            }
+#endif
+
+        private:
+            Sentinel s_ = Sentinel();
+        };
+
+        template<bool SizedRandomAccess>
+        struct take_bounds
+        {
+            template<typename View, typename N>
+            static constexpr auto begin(View & v, N)
+            {
+                return v.begin();
+            }
+            template<typename View, typename N>
+            static constexpr auto end(View & v, N n)
+            {
+                auto const first = v.begin();
+                return first + (std::min)(n, N(v.end() - first));
+            }
+        };
+        template<>
+        struct take_bounds<false>
+        {
+            template<typename View, typename N>
+            static constexpr auto begin(View & v, N n)
+            {
+                return take_iterator<range_iterator_t<View>>(v.begin(), n);
+            }
+            template<typename View, typename N>
+            static constexpr auto end(View & v, N)
+            {
+                return take_sentinel<range_sentinel_t<View>>(v.end());
+            }
+        };
+    }
+
+    /** A view of at most the first `count()` elements of a view `View`.
+
+        If `View` has random access iterators and a sized sentinel,
+        `take_view` iterates over the iterators of `View` directly; its end
+        is computed from `begin()` in O(1).  Otherwise, its iterators count
+        down to zero as they are incremented.
+
+        `views::take` only produces a `take_view` when it cannot produce a
+        `subrange` instead; this happens when the range is not random access,
+        or when it is an rvalue that `take_view` must take ownership of. */
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<std::movable View>
+#else
+    template<typename View>
+#endif
+    struct take_view : view_interface<take_view<View>>
+    {
+        using count_type = detail::range_difference_t<View>;
+
+        constexpr take_view() = default;
+        /** Precondition: `0 <= n`. */
+        constexpr take_view(View v, count_type n) : v_(std::move(v)), n_(n) {}
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        template<typename R>
+        constexpr take_view(detail::all_tag, R && r, count_type n) :
+            v_(views::all((R &&) r)), n_(n)
+        {}
+#endif
+
+        constexpr auto begin()
+        {
+            return detail::take_bounds<
+                detail::sized_random_access_v<View>>::begin(v_, n_);
+        }
+        constexpr auto end()
+        {
+            return detail::take_bounds<
+                detail::sized_random_access_v<View>>::end(v_, n_);
+        }
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename V = View const>
+        requires std::ranges::range<V>
+#else
+        template<
+            typename V = View const,
+            typename Enable =
+                std::enable_if_t<is_detected_v<detail::range_iterator_t, V>>>
+#endif
+        constexpr auto begin() const
+        {
+            return detail::take_bounds<
+                detail::sized_random_access_v<V>>::begin(v_, n_);
+        }
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename V = View const>
+        requires std::ranges::range<V>
+#else
+        template<
+            typename V = View const,
+            typename Enable =
+                std::enable_if_t<is_detected_v<detail::range_iterator_t, V>>>
+#endif
+        constexpr auto end() const
+        {
+            return detail::take_bounds<
+                detail::sized_random_access_v<V>>::end(v_, n_);
+        }
+
+        /** Returns the view this view takes from. */
+        constexpr View base() const &
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            requires std::copy_constructible<View>
+#endif
+        {
+            return v_;
+        }
+        /** Returns the view this view takes from. */
+        constexpr View base() && { return std::move(v_); }
+        /** Returns the maximum number of elements in this view. */
+        constexpr count_type count() const { return n_; }
+
+    private:
+        View v_ = View();
+        count_type n_ = 0;
+    };
+
+    namespace detail {
+        template<typename View>
+        struct enable_borrowed<take_view<View>> : enable_borrowed<View>
+        {};
+
+        template<typename T>
+        struct is_take_view : std::false_type
+        {};
+        template<typename View>
+        struct is_take_view<take_view<View>> : std::true_type
+        {};
+
+        // True iff r.base() can be had without copying anything expensive;
+        // that is, if the base is borrowed, or r is a mutable rvalue.
+        template<typename R, typename View>
+        constexpr bool cheap_base_v =
+            enable_borrowed<View>::value ||
+            (!std::is_lvalue_reference<R>::value &&
+             !std::is_const<std::remove_reference_t<R>>::value);
+
+        template<bool Borrowed, bool SizedRandomAccess>
+        struct take_impl_impl
+        {
+            template<typename R, typename N>
+            static constexpr auto call(R && r, N n)
+            {
+                auto const first = r.begin();
+                auto const size = r.end() - first;
+                using iterator = range_iterator_t<R>;
+                return subrange<iterator>(
+                    first, first + (std::min)(decltype(size)(n), size));
+            }
+        };
+        template<>
+        struct take_impl_impl<true, false>
+        {
+            template<typename R, typename N>
+            static constexpr auto call(R && r, N n)
+            {
+                using subrange_type =
+                    subrange<range_iterator_t<R>, range_sentinel_t<R>>;
+                return take_view<subrange_type>(
+                    subrange_type(r.begin(), r.end()), n);
+            }
+        };
+        template<bool SizedRandomAccess>
+        struct take_impl_impl<false, SizedRandomAccess>
+        {
+            template<typename R, typename N>
+            static constexpr auto call(R && r, N n)
+            {
+                return take_view<views::all_t<R>>(
+                    detail::all_tag{}, (R &&) r, n);
+            }
+        };
+
+        struct take_impl
+        {
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            template<typename R, std::integral N>
+#else
+            template<
+                typename R,
+                typename N,
+                typename Enable = std::enable_if_t<
+                    std::is_integral<N>::value &&
+                    is_detected_v<range_iterator_t, R>>>
+#endif
+            constexpr auto operator()(R && r, N n) const
+            {
+                return take_impl_impl<
+                    borrowed_range_v<R>,
+                    sized_random_access_v<R>>::
+                    call((R &&) r, range_difference_t<R>(n));
+            }
+
+            // take(take(v, m), n) is take(v, min(m, n)).
+            template<
+                typename R,
+                typename N,
+                typename Enable = std::enable_if_t<
+                    is_take_view<remove_cvref_t<R>>::value &&
+                    cheap_base_v<R, remove_cvref_t<R>>>>
+            constexpr auto simplify(R && r, N n) const
+            {
+                using view_type = remove_cvref_t<R>;
+                using count_type = typename view_type::count_type;
+                auto const count = (std::min)(r.count(), count_type(n));
+                return view_type(((R &&) r).base(), count);
+            }
+        };
+    }
+
+    namespace views {
+        /** A view adaptor that produces a view of at most the first `n`
+            elements of a range `r`, as in `take(r, n)` or `r | take(n)`.
+
+            If `r` is an lvalue, or a borrowed range like `subrange`, and it
+            has random access iterators and a sized sentinel, the result is
+            `subrange(first, first + min(n, size))`; the result has the same
+            iterator type as `r`.  If `r` is some other rvalue, the result is
+            a `take_view` of `all(std::move(r))`, so `r` is moved exactly
+            once, into an `owning_view` if it is not already a view.  Its
+            iterators are still those of `r` when `r` is random access and
+            sized.  Otherwise, the result is a
+            `take_view` over `subrange(r.begin(), r.end())`. */
+#if defined(__cpp_inline_variables) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+        inline constexpr adaptor<detail::take_impl> take =
+            detail::take_impl{};
+#else
+        namespace {
+            constexpr adaptor<detail::take_impl> take{detail::take_impl{}};
+        }
+#endif
+    }
+
+    /** A view of the elements of a bidirectional, common range `View`, in
+        reverse order.
+
+        `views::reverse` only produces a `reverse_view` for rvalues that it
+        must take ownership of; for other ranges, it produces a `subrange`
+        of reverse iterators. */
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<std::movable View>
+#else
+    template<typename View>
+#endif
+    struct reverse_view : view_interface<reverse_view<View>>
+    {
+        constexpr reverse_view() = default;
+        constexpr explicit reverse_view(View v) : v_(std::move(v)) {}
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        template<typename R>
+        constexpr reverse_view(detail::all_tag, R && r) :
+            v_(views::all((R &&) r))
+        {}
+#endif
+
+        constexpr auto begin()
+        {
+            return stl_interfaces::make_reverse_iterator(v_.end());
+        }
+        constexpr auto end()
+        {
+            return stl_interfaces::make_reverse_iterator(v_.begin());
+        }
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename V = View const>
+        requires std::ranges::range<V>
+#else
+        template<
+            typename V = View const,
+            typename Enable =
+                std::enable_if_t<is_detected_v<detail::range_iterator_t, V>>>
+#endif
+        constexpr auto begin() const
+        {
+            return stl_interfaces::make_reverse_iterator(v_.end());
+        }
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename V = View const>
+        requires std::ranges::range<V>
+#else
+        template<
+            typename V = View const,
+            typename Enable =
+                std::enable_if_t<is_detected_v<detail::range_iterator_t, V>>>
+#endif
+        constexpr auto end() const
+        {
+            return stl_interfaces::make_reverse_iterator(v_.begin());
+        }
+
+        /** Returns the view this view reverses. */
+        constexpr View base() const &
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            requires std::copy_constructible<View>
+#endif
+        {
+            return v_;
+        }
+        /** Returns the view this view reverses. */
+        constexpr View base() && { return std::move(v_); }
+
+    private:
+        View v_ = View();
+    };
+
+    namespace detail {
+        template<typename View>
+        struct enable_borrowed<reverse_view<View>> : enable_borrowed<View>
+        {};
+
+        template<typename T>
+        struct is_reverse_view : std::false_type
+        {};
+        template<typename View>
+        struct is_reverse_view<reverse_view<View>> : std::true_type
+        {};
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename R>
+        constexpr bool reversible_v = std::ranges::bidirectional_range<R> &&
+                                      std::ranges::common_range<R>;
+#else
+        template<typename R>
+        constexpr bool reversible_v =
+            std::is_base_of<
+                std::bidirectional_iterator_tag,
+                typename std::iterator_traits<
+                    range_iterator_t<R>>::iterator_category>::value &&
+            std::is_same<range_iterator_t<R>, range_sentinel_t<R>>::value;
+#endif
+
+        template<bool Borrowed>
+        struct reverse_impl_impl
+        {
+            template<typename R>
+            static constexpr auto call(R && r)
+            {
+                using iterator = decltype(stl_interfaces::make_reverse_iterator(
+                    std::declval<range_iterator_t<R>>()));
+                return subrange<iterator>(
+                    stl_interfaces::make_reverse_iterator(r.end()),
+                    stl_interfaces::make_reverse_iterator(r.begin()));
+            }
+        };
+        template<>
+        struct reverse_impl_impl<false>
+        {
+            template<typename R>
+            static constexpr auto call(R && r)
+            {
+                return reverse_view<views::all_t<R>>(
+                    detail::all_tag{}, (R &&) r);
+            }
+        };
+
+        struct reverse_impl
+        {
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            template<typename R>
+            requires reversible_v<R>
+#else
+            template<
+                typename R,
+                typename Enable = std::enable_if_t<
+                    is_detected_v<range_iterator_t, R> && reversible_v<R>>>
+#endif
+            constexpr auto operator()(R && r) const
+            {
+                return reverse_impl_impl<borrowed_range_v<R>>::call((R &&) r);
+            }
+
+            // reverse(reverse(v)) is v.  Reversing a subrange of reverse
+            // iterators needs no special case, since make_reverse_iterator()
+            // already unwraps them.
+            template<
+                typename R,
+                typename Enable = std::enable_if_t<
+                    is_reverse_view<remove_cvref_t<R>>::value &&
+                    cheap_base_v<R, remove_cvref_t<R>>>>
+            constexpr auto simplify(R && r) const
+            {
+                return ((R &&) r).base();
+            }
+        };
+    }
+
+    namespace views {
+        /** A view adaptor that produces a view of the elements of a
+            bidirectional, common range `r` in reverse order, as in
+            `reverse(r)` or `r | reverse`.
+
+            If `r` is an lvalue or a borrowed range, the result is a
+            `subrange` of reverse iterators; reversing that again gives a
+            `subrange` of the original iterators.  If `r` is some other
+            rvalue, the result is a `reverse_view` of `all(std::move(r))`,
+            so `r` is moved exactly once, into an `owning_view` if it is not
+            already a view.  Reversing an rvalue `reverse_view` gives back
+            the view it was made from. */
+#if defined(__cpp_inline_variables) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+        inline constexpr closure<detail::reverse_impl> reverse =
+            detail::reverse_impl{};
+#else
+        namespace {
+            constexpr closure<detail::reverse_impl> reverse{
+                detail::reverse_impl{}};
+        }
+#endif
+    }
+
+    /** A view of `n` copies of a value, with O(1) `size()`.  The view owns
+        its value, and its iterators refer to it, so they must not outlive
+        the view. */
+    template<typename T>
+    struct repeat_n_view : view_interface<repeat_n_view<T>>
+    {
+        constexpr repeat_n_view() = default;
+        constexpr repeat_n_view(T x, std::ptrdiff_t n) :
+            x_(std::move(x)), n_(n)
+        {}
+
+        constexpr repeat_iterator<T> begin() const
+        {
+            return repeat_iterator<T>(x_, 0);
+        }
+        constexpr repeat_iterator<T> end() const
+        {
+            return repeat_iterator<T>(x_, n_);
+        }
+
+    private:
+        T x_ = T();
+        std::ptrdiff_t n_ = 0;
+    };
+
+    /** A view of the integral values in `[first, last)`, with O(1)
+        `size()`. */
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<std::integral T>
+#else
+    template<
+        typename T,
+        typename Enable = std::enable_if_t<std::is_integral<T>::value>>
+#endif
+    struct iota_view : view_interface<iota_view<T>>
+    {
+        constexpr iota_view() = default;
+        /** Precondition: `first <= last`. */
+        constexpr iota_view(T first, T last) : first_(first), last_(last) {}
+
+        constexpr iota_iterator<T> begin() const
+        {
+            return iota_iterator<T>(first_);
+        }
+        constexpr iota_iterator<T> end() const
+        {
+            return iota_iterator<T>(last_);
+        }
+
+    private:
+        T first_ = T();
+        T last_ = T();
+    };
+
+    namespace detail {
+        template<typename T>
+        struct enable_borrowed<iota_view<T>> : std::true_type
+        {};
+
+        struct repeat_n_fn
+        {
+            template<typename T>
+            constexpr auto operator()(T && x, std::ptrdiff_t n) const
+            {
+                return repeat_n_view<remove_cvref_t<T>>((T &&) x, n);
+            }
+        };
+
+        struct iota_fn
+        {
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+            template<std::integral T>
+#else
+            template<
+                typename T,
+                typename Enable =
+                    std::enable_if_t<std::is_integral<T>::value>>
+#endif
+            constexpr auto operator()(T first, T last) const
+            {
+                return iota_view<T>(first, last);
+            }
+        };
+    }
+
+    namespace views {
+        /** Returns a `repeat_n_view` of `n` copies of `x`. */
+#if defined(__cpp_inline_variables) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+        inline constexpr detail::repeat_n_fn repeat_n;
+#else
+        namespace {
+            constexpr detail::repeat_n_fn repeat_n;
+        }
+#endif
+
+        /** Returns an `iota_view` of the values in `[first, last)`. */
+#if defined(__cpp_inline_variables) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+        inline constexpr detail::iota_fn iota;
+#else
+        namespace {
+            constexpr detail::iota_fn iota;
+        }
+#endif
+    }
+
+    namespace detail {
+        // The predicate of a filter_view is evaluated a block at a time,
+        // into a bitmask of the elements that pass.  The loop that builds
+        // the mask has no branches, so it does not mispredict on
+        // unpredictable data, and compilers can vectorize it.
+        constexpr std::ptrdiff_t filter_block_size = 32;
+        using filter_mask_t = std::uint32_t;
+
+        template<typename T, typename Pred>
+        filter_mask_t filter_block_mask(T * p, Pred const & pred)
+        {
+            filter_mask_t mask = 0;
+            for (std::ptrdiff_t i = 0; i < filter_block_size; ++i) {
+                mask |= filter_mask_t(static_cast<bool>(pred(p[i]))) << i;
+            }
+            return mask;
+        }
+        template<typename T, typename Pred>
+        filter_mask_t
+        filter_partial_block_mask(T * p, std::ptrdiff_t n, Pred const & pred)
+        {
+            filter_mask_t mask = 0;
+            for (std::ptrdiff_t i = 0; i < n; ++i) {
+                mask |= filter_mask_t(static_cast<bool>(pred(p[i]))) << i;
+            }
+            return mask;
+        }
+
+        // Precondition: mask != 0.
+        inline int count_trailing_zeros(filter_mask_t mask) noexcept
+        {
+#if defined(__cpp_lib_bitops)
+            return std::countr_zero(mask);
+#elif defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctz(mask);
+#elif defined(_MSC_VER)
+            unsigned long retval;
+            _BitScanForward(&retval, mask);
+            return int(retval);
+#else
+            int retval = 0;
+            for (; !(mask & 1u); mask >>= 1) {
+                ++retval;
+            }
+            return retval;
+#endif
+        }
+    }
+
+    /** The iterator type of `filter_view`.  It visits the elements of
+        `[first, last)` for which `pred` is true, evaluating `pred` one
+        block of elements at a time, and stepping from one selected element
+        to the next by counting trailing zeros in the block's bitmask.
+
+        Each element is passed to `pred` exactly once, in order, but the
+        calls for a block all happen when the iterator reaches that block,
+        before any of the block's elements are visited.  The iterator refers
+        to the predicate, which must outlive it. */
+    template<typename T, typename Pred>
+    struct filter_iterator : iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                                 filter_iterator<T, Pred>,
+#endif
+                                 std::forward_iterator_tag,
+                                 std::remove_cv_t<T>,
+                                 T &,
+                                 T *,
+                                 std::ptrdiff_t>
+    {
+        constexpr filter_iterator() noexcept :
+            cur_(nullptr),
+            block_(nullptr),
+            next_block_(nullptr),
+            last_(nullptr),
+            mask_(0),
+            pred_(nullptr)
+        {}
+        filter_iterator(T * first, T * last, Pred const & pred) :
+            cur_(first),
+            block_(first),
+            next_block_(first),
+            last_(last),
+            mask_(0),
+            pred_(std::addressof(pred))
+        {
+            find_next();
+        }
+
+        constexpr T & operator*() const noexcept { return *cur_; }
+
+        filter_iterator & operator++()
+        {
+            mask_ &= mask_ - 1u;
+            find_next();
+            return *this;
+        }
+
+        friend constexpr bool
+        operator==(filter_iterator lhs, filter_iterator rhs) noexcept
+        {
+            return lhs.cur_ == rhs.cur_;
+        }
+
+        /** Returns a pointer to the current element. */
+        constexpr T * base() const noexcept { return cur_; }
+
+        using base_type = iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+            filter_iterator<T, Pred>,
+#endif
+            std::forward_iterator_tag,
+            std::remove_cv_t<T>,
+            T &,
+            T *,
+            std::ptrdiff_t>;
+        using base_type::operator++;
+
+    private:
+        void find_next()
+        {
+            while (!mask_) {
+                if (next_block_ == last_) {
+                    cur_ = last_;
+                    return;
+                }
+                block_ = next_block_;
+                auto const n = last_ - block_;
+                if (detail::filter_block_size <= n) {
+                    next_block_ = block_ + detail::filter_block_size;
+                    mask_ = detail::filter_block_mask(block_, *pred_);
+                } else {
+                    next_block_ = last_;
+                    mask_ =
+                        detail::filter_partial_block_mask(block_, n, *pred_);
+                }
+            }
+            cur_ = block_ + detail::count_trailing_zeros(mask_);
+        }
+
+        T * cur_;
+        T * block_;
+        T * next_block_;
+        T * last_;
+        detail::filter_mask_t mask_;
+        Pred const * pred_;
+    };
+
+    /** A view of the elements of a contiguous, sized view `View` of
+        arithmetic values for which `Pred` is true.  `begin()` is O(n), since
+        it must find the first such element.  The iterators refer to the
+        view, and must not outlive it. */
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    template<std::movable View, typename Pred>
+#else
+    template<typename View, typename Pred>
+#endif
+    struct filter_view : view_interface<filter_view<View, Pred>>
+    {
+        constexpr filter_view() = default;
+        constexpr filter_view(View v, Pred pred) :
+            v_(std::move(v)), pred_(std::move(pred))
+        {}
+
+        auto begin()
+        {
+            using iterator = filter_iterator<
+                std::remove_pointer_t<decltype(v_.data())>,
+                Pred>;
+            auto const first = v_.data();
+            return iterator(first, first + v_.size(), pred_);
+        }
+        auto end()
+        {
+            using iterator = filter_iterator<
+                std::remove_pointer_t<decltype(v_.data())>,
+                Pred>;
+            auto const last = v_.data() + v_.size();
+            return iterator(last, last, pred_);
+        }
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename V = View const>
+        requires requires(V & v) { v.data(); }
+#else
+        template<
+            typename V = View const,
+            typename Enable =
+                std::enable_if_t<is_detected_v<detail::range_data_expr, V>>>
+#endif
+        auto begin() const
+        {
+            using iterator = filter_iterator<
+                std::remove_pointer_t<decltype(v_.data())>,
+                Pred>;
+            auto const first = v_.data();
+            return iterator(first, first + v_.size(), pred_);
+        }
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+        template<typename V = View const>
+        requires requires(V & v) { v.data(); }
+#else
+        template<
+            typename V = View const,
+            typename Enable =
+                std::enable_if_t<is_detected_v<detail::range_data_expr, V>>>
+#endif
+        auto end() const
+        {
+            using iterator = filter_iterator<
+                std::remove_pointer_t<decltype(v_.data())>,
+                Pred>;
+            auto const last = v_.data() + v_.size();
+            return iterator(last, last, pred_);
+        }
+
+        /** Returns the view this view filters. */
+        constexpr View base() const & { return v_; }
+        /** Returns the view this view filters. */
+        constexpr View base() && { return std::move(v_); }
+
+    private:
+        View v_ = View();
+        Pred pred_ = Pred();
+    };
+
+    namespace detail {
+        template<typename R>
+        using range_element_t =
+            std::remove_pointer_t<decltype(std::declval<R &>().data())>;
+
+        template<typename R, bool HasData = is_detected_v<range_data_expr, R>>
+        struct filterable : std::false_type
+        {};
+        template<typename R>
+        struct filterable<R, true>
+            : std::integral_constant<
+                  bool,
+                  std::is_arithmetic<
+                      std::remove_cv_t<range_element_t<R>>>::value &&
+                      is_detected_v<range_size_expr, R>>
+        {};
+
+        struct filter_impl
+        {
+            template<
+                typename R,
+                typename Pred,
+                typename Enable = std::enable_if_t<
+                    filterable<std::remove_reference_t<R>>::value>>
+            constexpr auto operator()(R && r, Pred pred) const
+            {
+                return filter_view<views::all_t<R>, Pred>(
+                    views::all((R &&) r), std::move(pred));
+            }
+        };
+    }
+
+    namespace views {
+        /** A view adaptor that produces a view of the elements of `r` for
+            which `pred` is true, as in `filter(r, pred)` or `r |
+            filter(pred)`.  `r` must be contiguous (it must have `data()`
+            and `size()` members), and its elements must be arithmetic.
+
+            Unlike an element-at-a-time filter, `pred` is evaluated on
+            blocks of elements without branching, so a selective filter over
+            unpredictable data does not pay for a branch misprediction on
+            most elements.  See `filter_iterator`. */
+#if defined(__cpp_inline_variables) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+        inline constexpr adaptor<detail::filter_impl> filter =
+            detail::filter_impl{};
+#else
+        namespace {
+            constexpr adaptor<detail::filter_impl> filter{
+                detail::filter_impl{}};
+        }
+#endif
+    }
+
+}}
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+namespace std::ranges {
+    template<typename Iter, typename Sentinel>
+    inline constexpr bool enable_borrowed_range<
+        boost::stl_interfaces::subrange<Iter, Sentinel>> = true;
+    template<typename View>
+    inline constexpr bool enable_borrowed_range<
+        boost::stl_interfaces::take_view<View>> = enable_borrowed_range<View>;
+    template<typename View>
+    inline constexpr bool enable_borrowed_range<
+        boost::stl_interfaces::reverse_view<View>> =
+        enable_borrowed_range<View>;
+    template<typename R>
+    inline constexpr bool
+        enable_borrowed_range<boost::stl_interfaces::ref_view<R>> = true;
+    template<typename T>
+    inline constexpr bool
+        enable_borrowed_range<boost::stl_interfaces::iota_view<T>> = true;
+    template<typename R>
+    inline constexpr bool
+        enable_borrowed_range<boost::stl_interfaces::owning_view<R>> =
+            enable_borrowed_range<R>;
+}
+#endif
+
+#endif
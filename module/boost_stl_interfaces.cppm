@@ -0,0 +1,127 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// The boost.stl_interfaces named module.  The headers are included in the
+// global module fragment, so they are parsed once, when this interface unit
+// is built, and the names below are exported from it.
+//
+// Only the C++20 (v2) and later interfaces are exported, since modules
+// require C++20.  Macros are not exported; a TU that needs
+// BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT() or the like must still
+// include the header that defines it.
+module;
+
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/generating_iterators.hpp>
+#include <boost/stl_interfaces/hash.hpp>
+#include <boost/stl_interfaces/instrumented_iterator.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/prefetch_iterator.hpp>
+#include <boost/stl_interfaces/remove.hpp>
+#include <boost/stl_interfaces/reverse_iterator.hpp>
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+#include <boost/stl_interfaces/serialization.hpp>
+#include <boost/stl_interfaces/static_vector.hpp>
+#include <boost/stl_interfaces/view_adaptor.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+#include <boost/stl_interfaces/views.hpp>
+
+export module boost.stl_interfaces;
+
+export namespace boost { namespace stl_interfaces {
+
+    // fwd.hpp
+    using boost::stl_interfaces::element_layout;
+
+    // iterator_interface.hpp
+    using boost::stl_interfaces::access;
+    using boost::stl_interfaces::proxy_arrow_result;
+    using boost::stl_interfaces::iterator_interface;
+    using boost::stl_interfaces::proxy_iterator_interface;
+    using boost::stl_interfaces::operator+;
+    using boost::stl_interfaces::operator-;
+    using boost::stl_interfaces::operator<=>;
+    using boost::stl_interfaces::operator<;
+    using boost::stl_interfaces::operator<=;
+    using boost::stl_interfaces::operator>;
+    using boost::stl_interfaces::operator>=;
+    using boost::stl_interfaces::operator==;
+    using boost::stl_interfaces::operator!=;
+
+    // reverse_iterator.hpp
+    using boost::stl_interfaces::reverse_iterator;
+    using boost::stl_interfaces::make_reverse_iterator;
+    using boost::stl_interfaces::caching_reverse_iterator;
+    using boost::stl_interfaces::make_caching_reverse_iterator;
+
+    // sequence_container_interface.hpp
+    using boost::stl_interfaces::sequence_container_interface;
+    using boost::stl_interfaces::append_and_rotate;
+
+    // static_vector.hpp
+    using boost::stl_interfaces::static_vector;
+
+    // view_interface.hpp
+    using boost::stl_interfaces::view_interface;
+
+    // view_adaptor.hpp
+    using boost::stl_interfaces::bind_back;
+    using boost::stl_interfaces::range_adaptor_closure;
+    using boost::stl_interfaces::closure;
+    using boost::stl_interfaces::adaptor;
+
+    // views.hpp
+    using boost::stl_interfaces::subrange;
+    using boost::stl_interfaces::take_view;
+    using boost::stl_interfaces::reverse_view;
+    using boost::stl_interfaces::ref_view;
+    using boost::stl_interfaces::owning_view;
+    using boost::stl_interfaces::repeat_iterator;
+    using boost::stl_interfaces::iota_iterator;
+    using boost::stl_interfaces::repeat_n_view;
+    using boost::stl_interfaces::iota_view;
+    using boost::stl_interfaces::filter_iterator;
+    using boost::stl_interfaces::filter_view;
+    namespace views {
+        using boost::stl_interfaces::views::all;
+        using boost::stl_interfaces::views::take;
+        using boost::stl_interfaces::views::reverse;
+        using boost::stl_interfaces::views::repeat_n;
+        using boost::stl_interfaces::views::iota;
+        using boost::stl_interfaces::views::filter;
+    }
+
+    // algorithm.hpp
+    using boost::stl_interfaces::copy;
+    using boost::stl_interfaces::copy_n;
+    using boost::stl_interfaces::uninitialized_copy;
+    using boost::stl_interfaces::transform;
+    using boost::stl_interfaces::find;
+    using boost::stl_interfaces::equal;
+    using boost::stl_interfaces::remove_if;
+    using boost::stl_interfaces::remove;
+
+    // hash.hpp
+    using boost::stl_interfaces::range_hash;
+    using boost::stl_interfaces::hash_value;
+
+    // serialization.hpp
+    using boost::stl_interfaces::serialization_header;
+    using boost::stl_interfaces::serialized_size;
+    using boost::stl_interfaces::write_to;
+    using boost::stl_interfaces::read_from;
+
+    // instrumented_iterator.hpp
+    using boost::stl_interfaces::iterator_op_counts;
+    using boost::stl_interfaces::instrumentation_counts;
+    using boost::stl_interfaces::instrumented_iterator;
+    using boost::stl_interfaces::instrumented_t;
+
+    // prefetch_iterator.hpp
+    using boost::stl_interfaces::prefetch_iterator;
+    using boost::stl_interfaces::make_prefetch_iterator;
+
+}}
@@ -0,0 +1,50 @@
+# Copyright (C) 2026 T. Zachary Laine
+#
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# Run by the build_time_benchmark target.  For each variant, this builds
+# everything the variant depends on (including the module itself), touches
+# the variant's TUs, and then times a serial rebuild of just those TUs.
+
+function(build target)
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --config ${CONFIG}
+            --target ${target} ${ARGN}
+        RESULT_VARIABLE result
+        OUTPUT_QUIET)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "Building ${target} failed.")
+    endif ()
+endfunction()
+
+# One timestamp, so that the seconds and the fraction cannot come from
+# different seconds.  %f is always six digits, so "%s%f" is the time in
+# microseconds.
+function(now_ms out)
+    string(TIMESTAMP us "%s%f" UTC)
+    math(EXPR ms "${us} / 1000")
+    set(${out} ${ms} PARENT_SCOPE)
+endfunction()
+
+foreach (variant headers module)
+    if (variant STREQUAL headers)
+        set(dir ${HEADERS_TU_DIR})
+    else ()
+        set(dir ${MODULE_TU_DIR})
+    endif ()
+    file(GLOB sources ${dir}/*.cpp)
+    list(LENGTH sources tus)
+
+    build(build_time_${variant})
+    file(TOUCH ${sources})
+    now_ms(start)
+    build(build_time_${variant} --parallel 1)
+    now_ms(finish)
+
+    math(EXPR total "${finish} - ${start}")
+    math(EXPR per_tu "${total} / ${tus}")
+    message(STATUS
+        "${variant}: ${total} ms for ${tus} TUs (${per_tu} ms per TU)")
+endforeach ()
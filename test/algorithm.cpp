@@ -0,0 +1,427 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/reverse_iterator.hpp>
+#include <boost/stl_interfaces/views.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+struct basic_output_iter
+    : boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+          basic_output_iter,
+#endif
+          std::output_iterator_tag, int>
+{
+    basic_output_iter() : it_(nullptr) {}
+    basic_output_iter(int * it) : it_(it) {}
+
+    int & operator*() noexcept { return *it_; }
+    basic_output_iter & operator++() noexcept
+    {
+        ++it_;
+        return *this;
+    }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+        basic_output_iter,
+#endif
+        std::output_iterator_tag, int>;
+    using base_type::operator++;
+
+private:
+    int * it_;
+};
+
+struct calls
+{
+    int push_backs = 0;
+    int write_ns = 0;
+    int reserve_hints = 0;
+};
+
+// WriteN and ReserveHint turn the two bulk-write members on and off.
+template<bool WriteN, bool ReserveHint>
+struct bulk_back_insert_iter : boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                                   bulk_back_insert_iter<WriteN, ReserveHint>,
+#endif
+                                   std::output_iterator_tag,
+                                   int,
+                                   bulk_back_insert_iter<WriteN, ReserveHint> &>
+{
+    bulk_back_insert_iter() : c_(nullptr), calls_(nullptr) {}
+    bulk_back_insert_iter(std::vector<int> & c, calls & counts) :
+        c_(std::addressof(c)), calls_(std::addressof(counts))
+    {}
+
+    bulk_back_insert_iter & operator*() noexcept { return *this; }
+    bulk_back_insert_iter & operator++() noexcept { return *this; }
+
+    bulk_back_insert_iter & operator=(int v)
+    {
+        ++calls_->push_backs;
+        c_->push_back(v);
+        return *this;
+    }
+
+    template<bool Enable = WriteN, typename E = std::enable_if_t<Enable>>
+    bulk_back_insert_iter & write_n(int const * p, std::size_t n)
+    {
+        ++calls_->write_ns;
+        c_->insert(c_->end(), p, p + n);
+        return *this;
+    }
+    template<bool Enable = ReserveHint, typename E = std::enable_if_t<Enable>>
+    void reserve_hint(std::size_t n)
+    {
+        ++calls_->reserve_hints;
+        c_->reserve(c_->size() + n);
+    }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+        bulk_back_insert_iter<WriteN, ReserveHint>,
+#endif
+        std::output_iterator_tag,
+        int,
+        bulk_back_insert_iter<WriteN, ReserveHint> &>;
+    using base_type::operator++;
+
+private:
+    std::vector<int> * c_;
+    calls * calls_;
+};
+
+using bulk_inserter = bulk_back_insert_iter<true, true>;
+using write_n_inserter = bulk_back_insert_iter<true, false>;
+using reserving_inserter = bulk_back_insert_iter<false, true>;
+using plain_inserter = bulk_back_insert_iter<false, false>;
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+static_assert(std::output_iterator<bulk_inserter, int>, "");
+#endif
+
+namespace bsi = boost::stl_interfaces;
+
+std::vector<int> const ints = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+std::list<int> const int_list(ints.begin(), ints.end());
+
+
+int main()
+{
+
+// copy()
+{
+    std::vector<int> result;
+    calls c;
+    bsi::copy(ints.data(), ints.data() + ints.size(), bulk_inserter(result, c));
+    BOOST_TEST(result == ints);
+    BOOST_TEST(c.write_ns == 1);
+    BOOST_TEST(c.reserve_hints == 0);
+    BOOST_TEST(c.push_backs == 0);
+}
+{
+    std::vector<int> result;
+    calls c;
+    bsi::copy(ints.begin(), ints.end(), bulk_inserter(result, c));
+    BOOST_TEST(result == ints);
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+    // std::vector<int>::iterator is a std::contiguous_iterator.
+    BOOST_TEST(c.write_ns == 1);
+    BOOST_TEST(c.push_backs == 0);
+#else
+    BOOST_TEST(c.reserve_hints == 1);
+    BOOST_TEST(c.push_backs == 10);
+#endif
+}
+{
+    std::vector<int> result;
+    calls c;
+    bsi::copy(
+        ints.data(), ints.data() + ints.size(), reserving_inserter(result, c));
+    BOOST_TEST(result == ints);
+    BOOST_TEST(c.write_ns == 0);
+    BOOST_TEST(c.reserve_hints == 1);
+    BOOST_TEST(c.push_backs == 10);
+}
+{
+    // A std::list is not sized, so there is nothing to reserve.
+    std::vector<int> result;
+    calls c;
+    bsi::copy(int_list.begin(), int_list.end(), bulk_inserter(result, c));
+    BOOST_TEST(result == ints);
+    BOOST_TEST(c.write_ns == 0);
+    BOOST_TEST(c.reserve_hints == 0);
+    BOOST_TEST(c.push_backs == 10);
+}
+{
+    std::vector<int> result;
+    calls c;
+    bsi::copy(
+        ints.data(), ints.data() + ints.size(), plain_inserter(result, c));
+    BOOST_TEST(result == ints);
+    BOOST_TEST(c.push_backs == 10);
+}
+{
+    std::vector<int> result;
+    calls c;
+    bsi::copy(ints.data(), ints.data(), write_n_inserter(result, c));
+    BOOST_TEST(result.empty());
+    BOOST_TEST(c.write_ns == 0);
+}
+{
+    std::vector<int> result(ints.size());
+    bsi::copy(ints.begin(), ints.end(), basic_output_iter(result.data()));
+    BOOST_TEST(result == ints);
+}
+{
+    // Unqualified calls still find std::copy().
+    std::vector<int> result;
+    calls c;
+    copy(ints.begin(), ints.end(), plain_inserter(result, c));
+    BOOST_TEST(result == ints);
+}
+
+// copy_n()
+{
+    std::vector<int> result;
+    calls c;
+    bsi::copy_n(ints.data(), 4, bulk_inserter(result, c));
+    BOOST_TEST(result == std::vector<int>({0, 1, 2, 3}));
+    BOOST_TEST(c.write_ns == 1);
+}
+{
+    std::vector<int> result;
+    calls c;
+    bsi::copy_n(int_list.begin(), 4, reserving_inserter(result, c));
+    BOOST_TEST(result == std::vector<int>({0, 1, 2, 3}));
+    BOOST_TEST(c.reserve_hints == 1);
+    BOOST_TEST(c.push_backs == 4);
+}
+{
+    std::vector<int> result;
+    calls c;
+    bsi::copy_n(int_list.begin(), 0, reserving_inserter(result, c));
+    BOOST_TEST(result.empty());
+    BOOST_TEST(c.reserve_hints == 0);
+}
+
+// transform()
+{
+    std::vector<int> result;
+    calls c;
+    bsi::transform(
+        ints.begin(), ints.end(), bulk_inserter(result, c), [](int x) {
+            return x * 2;
+        });
+    BOOST_TEST(result == std::vector<int>({0, 2, 4, 6, 8, 10, 12, 14, 16, 18}));
+    BOOST_TEST(c.write_ns == 0);
+    BOOST_TEST(c.reserve_hints == 1);
+    BOOST_TEST(c.push_backs == 10);
+}
+{
+    std::vector<int> result;
+    calls c;
+    bsi::transform(
+        int_list.begin(),
+        int_list.end(),
+        write_n_inserter(result, c),
+        [](int x) { return x + 1; });
+    BOOST_TEST(result == std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+    BOOST_TEST(c.reserve_hints == 0);
+    BOOST_TEST(c.push_backs == 10);
+}
+
+// Reverse iterators over pointers.
+{
+    std::vector<int> result(ints.size());
+    auto const first = bsi::make_reverse_iterator(ints.data() + ints.size());
+    auto const last = bsi::make_reverse_iterator(ints.data());
+    int * const out = bsi::copy(first, last, result.data());
+    BOOST_TEST(out == result.data() + result.size());
+    BOOST_TEST(result == std::vector<int>({9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+
+    std::vector<int> result2(ints.size());
+    auto const out2 = bsi::copy(
+        first, last, bsi::make_reverse_iterator(result2.data() + 10));
+    BOOST_TEST(out2 == bsi::make_reverse_iterator(result2.data()));
+    BOOST_TEST(result2 == ints);
+
+    std::vector<int> result3(ints.size());
+    bsi::copy(
+        std::make_reverse_iterator(ints.data() + 10),
+        std::make_reverse_iterator(ints.data() + 5),
+        std::make_reverse_iterator(result3.data() + 10));
+    BOOST_TEST(result3 == std::vector<int>({0, 0, 0, 0, 0, 5, 6, 7, 8, 9}));
+
+    BOOST_TEST(bsi::equal(first, last, bsi::make_reverse_iterator(
+                                           result2.data() + 10)));
+    BOOST_TEST(!bsi::equal(first, last, bsi::make_reverse_iterator(
+                                            result.data() + 10)));
+    BOOST_TEST(bsi::equal(first, last, result.begin(), result.end()));
+    BOOST_TEST(!bsi::equal(first, last - 1, result.begin(), result.end()));
+    BOOST_TEST(bsi::equal(
+        first,
+        last,
+        std::make_reverse_iterator(ints.end()),
+        std::make_reverse_iterator(ints.begin())));
+
+    BOOST_TEST(*bsi::find(first, last, 3) == 3);
+    BOOST_TEST(bsi::find(first, last, 3) - first == 6);
+    BOOST_TEST(bsi::find(first, last, 42) == last);
+    BOOST_TEST(bsi::find(first, first, 3) == first);
+}
+{
+    std::string const log = "a=1\nb=2\nc=3";
+    char const * const first = log.data();
+    char const * const last = log.data() + log.size();
+    auto const rfirst = bsi::make_reverse_iterator(last);
+    auto const rlast = bsi::make_reverse_iterator(first);
+
+    BOOST_TEST(bsi::find(first, last, '\n') == first + 3);
+    BOOST_TEST(bsi::find(first, last, '!') == last);
+    BOOST_TEST(bsi::find(first, first, 'a') == first);
+    BOOST_TEST(bsi::find(rfirst, rlast, '\n').base() == first + 8);
+    BOOST_TEST(bsi::find(rfirst, rlast, 'a').base() == first + 1);
+    BOOST_TEST(bsi::find(rfirst, rlast, '!') == rlast);
+    BOOST_TEST(bsi::find(rfirst, rfirst, 'a') == rfirst);
+    // An int argument does not take the memchr() path.
+    BOOST_TEST(bsi::find(rfirst, rlast, int('b')).base() == first + 5);
+
+    std::vector<unsigned char> bytes = {0, 255, 7, 255, 0};
+    BOOST_TEST(
+        bsi::find(
+            std::make_reverse_iterator(bytes.data() + bytes.size()),
+            std::make_reverse_iterator(bytes.data()),
+            (unsigned char)255)
+            .base() == bytes.data() + 4);
+}
+{
+    std::list<int> l(ints.begin(), ints.end());
+    BOOST_TEST(*bsi::find(l.begin(), l.end(), 4) == 4);
+    BOOST_TEST(bsi::equal(l.begin(), l.end(), ints.begin()));
+    BOOST_TEST(bsi::equal(l.begin(), l.end(), ints.begin(), ints.end()));
+    BOOST_TEST(!bsi::equal(l.begin(), l.end(), ints.begin(), ints.end() - 1));
+}
+
+// Copies from repeat_iterators and iota_iterators.
+{
+    std::vector<char> buf(8, 'x');
+    auto const pad = bsi::views::repeat_n('-', 5);
+    char * const out = bsi::copy(pad.begin(), pad.end(), buf.data() + 1);
+    BOOST_TEST(out == buf.data() + 6);
+    BOOST_TEST(std::string(buf.begin(), buf.end()) == "x-----xx");
+    BOOST_TEST(bsi::copy(pad.begin(), pad.begin(), buf.data()) == buf.data());
+    BOOST_TEST(bsi::copy_n(pad.begin(), 2, buf.data()) == buf.data() + 2);
+    BOOST_TEST(std::string(buf.begin(), buf.end()) == "------xx");
+
+    std::vector<int> result(6);
+    auto const indices = bsi::views::iota(10, 15);
+    BOOST_TEST(
+        bsi::copy(indices.begin(), indices.end(), result.data()) ==
+        result.data() + 5);
+    BOOST_TEST(result == std::vector<int>({10, 11, 12, 13, 14, 0}));
+    BOOST_TEST(bsi::copy_n(indices.begin(), 0, result.data()) == result.data());
+
+    // Non-contiguous destinations take the usual path.
+    std::vector<int> inserted;
+    calls c;
+    bsi::copy(indices.begin(), indices.end(), bulk_inserter(inserted, c));
+    BOOST_TEST(inserted == std::vector<int>({10, 11, 12, 13, 14}));
+    BOOST_TEST(c.reserve_hints == 1);
+    std::list<int> l(3);
+    bsi::copy(pad.begin(), pad.begin() + 3, l.begin());
+    BOOST_TEST(l == std::list<int>(3, '-'));
+}
+
+// uninitialized_copy()
+{
+    std::allocator<std::string> alloc;
+    std::string * const p = alloc.allocate(4);
+    auto const strs = bsi::views::repeat_n(std::string("pad"), 3);
+    std::string * const last =
+        bsi::uninitialized_copy(strs.begin(), strs.end(), p);
+    BOOST_TEST(last == p + 3);
+    BOOST_TEST(p[0] == "pad" && p[2] == "pad");
+    BOOST_TEST(bsi::uninitialized_copy(last, last, last) == last);
+    std::string * const last2 = bsi::uninitialized_copy(p, p + 1, last);
+    BOOST_TEST(last2 == p + 4);
+    BOOST_TEST(p[3] == "pad");
+    for (std::string * it = p; it != last2; ++it) {
+        it->~basic_string();
+    }
+    alloc.deallocate(p, 4);
+}
+
+// remove_if() and remove()
+{
+    auto const odd = [](int x) { return x % 2 != 0; };
+    for (int n = 0; n < 40; ++n) {
+        std::vector<int> vec;
+        for (int i = 0; i < n; ++i) {
+            vec.push_back((i * 5) % 7);
+        }
+        std::vector<int> expected = vec;
+        expected.erase(
+            std::remove_if(expected.begin(), expected.end(), odd),
+            expected.end());
+
+        // Contiguous and trivially copyable, so branchless.
+        std::vector<int> contiguous = vec;
+        auto const it =
+            bsi::remove_if(contiguous.begin(), contiguous.end(), odd);
+        contiguous.erase(it, contiguous.end());
+        BOOST_TEST(contiguous == expected);
+
+        std::list<int> l(vec.begin(), vec.end());
+        l.erase(bsi::remove_if(l.begin(), l.end(), odd), l.end());
+        BOOST_TEST(std::vector<int>(l.begin(), l.end()) == expected);
+    }
+
+    // The predicate is called once per element.
+    std::vector<int> vec = {1, 2, 3, 4, 5, 6};
+    int calls = 0;
+    auto const it = bsi::remove_if(vec.data(), vec.data() + 6, [&](int x) {
+        ++calls;
+        return x == 2 || x == 5;
+    });
+    BOOST_TEST(calls == 6);
+    BOOST_TEST(it == vec.data() + 4);
+    BOOST_TEST(
+        std::vector<int>(vec.data(), it) == std::vector<int>({1, 3, 4, 6}));
+
+    std::vector<std::string> strs = {"a", "b", "a", "c"};
+    strs.erase(bsi::remove(strs.begin(), strs.end(), "a"), strs.end());
+    BOOST_TEST(strs == std::vector<std::string>({"b", "c"}));
+
+    // Large trivially copyable elements keep the branching loop, since
+    // copying every one of them would cost more than the branches.
+    struct big
+    {
+        int id;
+        char payload[60];
+    };
+    static_assert(bsi::detail::remove_strategy<int *>::value, "");
+    static_assert(!bsi::detail::remove_strategy<big *>::value, "");
+    big bigs[4] = {{1, {}}, {2, {}}, {3, {}}, {4, {}}};
+    big * const bigs_end = bsi::remove_if(
+        bigs, bigs + 4, [](big const & b) { return b.id % 2 == 0; });
+    BOOST_TEST(bigs_end == bigs + 2);
+    BOOST_TEST(bigs[0].id == 1 && bigs[1].id == 3);
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,148 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/static_vector.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <string>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using vec_type = bsi::static_vector<int, 16>;
+
+// Instantiate all the members we can.
+template struct bsi::static_vector<int, 1024>;
+template struct bsi::static_vector<std::string, 8>;
+
+#if BOOST_STL_INTERFACES_CONSTEXPR_STATIC_VECTOR
+
+// A type with nontrivial special members, which can still be used during
+// constant evaluation.
+struct boxed
+{
+    constexpr boxed(int i = 0) : value_(i) {}
+    constexpr boxed(boxed const & other) : value_(other.value_) {}
+    constexpr boxed & operator=(boxed const & other)
+    {
+        value_ = other.value_;
+        return *this;
+    }
+    constexpr ~boxed() {}
+
+    friend constexpr bool operator==(boxed lhs, boxed rhs)
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    int value_;
+};
+
+constexpr vec_type make_table()
+{
+    vec_type v;
+    for (int i = 0; i < 6; ++i) {
+        v.push_back(i * i);
+    }
+    v.insert(v.begin() + 1, {100, 101});
+    v.erase(v.begin() + 3);
+    v.insert(v.end(), 2, 7);
+    v.insert(v.begin(), 1, 5);
+    v.pop_back();
+    return v;
+}
+
+// The table is computed entirely at compile time.
+constexpr vec_type table = make_table();
+static_assert(table.size() == 9u);
+static_assert(table == vec_type({5, 0, 100, 101, 4, 9, 16, 25, 7}));
+static_assert(table.front() == 5 && table.back() == 7);
+static_assert(vec_type({1, 2}) < table && table <= table);
+static_assert(*table.data() == 5);
+static_assert(*table.rbegin() == 7);
+
+constexpr bool nontrivial_elements()
+{
+    using boxed_vec = bsi::static_vector<boxed, 8>;
+    boxed_vec v = {1, 2, 3};
+    boxed_vec w = v;
+    w.assign({4, 5});
+    w.emplace(w.begin(), 9);
+    v.swap(w);
+    boxed_vec u(3, boxed(1));
+    u.resize(5);
+    u.erase(u.begin() + 1);
+    u = std::move(w);
+    return v == boxed_vec({9, 4, 5}) && u == boxed_vec({1, 2, 3}) &&
+           w.empty();
+}
+#if BOOST_STL_INTERFACES_CONSTEXPR_NONTRIVIAL_STATIC_VECTOR
+static_assert(nontrivial_elements());
+#endif
+
+constexpr bool free_functions()
+{
+    vec_type v = {1, 2, 3, 4, 5, 6};
+    auto const removed = erase_if(v, [](int x) { return x % 2 == 0; });
+    vec_type w;
+    swap(v, w);
+    w.resize_for_overwrite(4);
+    return removed == 3u && v.empty() && w == vec_type({1, 3, 5, 0});
+}
+static_assert(free_functions());
+
+#endif
+
+
+int main()
+{
+
+// The same operations at run time.
+{
+    vec_type v = {1, 2, 3};
+    v.insert(v.begin() + 1, {7, 8, 9});
+    BOOST_TEST(v == vec_type({1, 7, 8, 9, 2, 3}));
+    v.insert(v.begin() + 4, {6});
+    BOOST_TEST(v == vec_type({1, 7, 8, 9, 6, 2, 3}));
+    v.erase(v.begin(), v.begin() + 2);
+    BOOST_TEST(v == vec_type({8, 9, 6, 2, 3}));
+    v.emplace(v.begin() + 1, 4);
+    BOOST_TEST(v == vec_type({8, 4, 9, 6, 2, 3}));
+    BOOST_TEST(v.data() == &v[0]);
+    BOOST_TEST(v.capacity() == 16u);
+
+    v.resize_for_overwrite(8);
+    BOOST_TEST(v.size() == 8u);
+    v.resize(2);
+    BOOST_TEST(v == vec_type({8, 4}));
+}
+
+// Nontrivial elements are constructed and destroyed exactly once.
+{
+    using str_vec = bsi::static_vector<std::string, 8>;
+    str_vec v = {"a", "b", "c"};
+    v.insert(v.begin() + 1, 2, std::string(40, 'x'));
+    BOOST_TEST(v.size() == 5u);
+    BOOST_TEST(v[1] == std::string(40, 'x'));
+    BOOST_TEST(v[3] == "b");
+
+    str_vec w = {"d"};
+    v.swap(w);
+    BOOST_TEST(v == str_vec({"d"}));
+    BOOST_TEST(w.size() == 5u);
+    BOOST_TEST(w.back() == "c");
+
+    w.erase(w.begin(), w.begin() + 3);
+    BOOST_TEST(w == str_vec({"b", "c"}));
+    w = v;
+    BOOST_TEST(w == v);
+    w.clear();
+    BOOST_TEST(w.empty());
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "debug_perf.hpp"
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+
+// Runs each loop in debug_perf_pointer.cpp and debug_perf_iterator.cpp
+// over the same data, checks that the two agree, and prints the time per
+// element of each, and their ratio.  The optional argument is the number
+// of times to repeat each loop; ctest runs it once, as a correctness test.
+
+namespace {
+
+    using clock_type = std::chrono::steady_clock;
+
+    struct timing
+    {
+        double pointer_ns = 0.0;
+        double iterator_ns = 0.0;
+    };
+
+    double ns_per_element(clock_type::duration d, int reps)
+    {
+        return std::chrono::duration<double, std::nano>(d).count() /
+               (double(reps) * double(debug_perf_size));
+    }
+
+    void report(char const * name, timing t)
+    {
+        std::printf(
+            "%-16s %10.3f %10.3f %8.2fx\n",
+            name,
+            t.pointer_ns,
+            t.iterator_ns,
+            t.iterator_ns / t.pointer_ns);
+    }
+
+    template<typename PointerLoop, typename IteratorLoop>
+    timing time_sums(int reps, PointerLoop pointer, IteratorLoop iterator)
+    {
+        timing retval;
+        long long pointer_sum = 0;
+        long long iterator_sum = 0;
+
+        auto start = clock_type::now();
+        for (int i = 0; i < reps; ++i) {
+            pointer_sum += pointer();
+        }
+        retval.pointer_ns = ns_per_element(clock_type::now() - start, reps);
+
+        start = clock_type::now();
+        for (int i = 0; i < reps; ++i) {
+            iterator_sum += iterator();
+        }
+        retval.iterator_ns = ns_per_element(clock_type::now() - start, reps);
+
+        BOOST_TEST(iterator_sum == pointer_sum);
+        return retval;
+    }
+
+    debug_perf_vector vec;
+}
+
+
+int main(int argc, char * argv[])
+{
+    int const reps = 1 < argc ? std::max(std::atoi(argv[1]), 1) : 1;
+
+    std::vector<int> unsorted = [] {
+        std::vector<int> retval(debug_perf_size);
+        unsigned int x = 1;
+        for (auto & i : retval) {
+            x = x * 1664525u + 1013904223u;
+            i = int(x >> 16);
+        }
+        return retval;
+    }();
+    int * const first = unsorted.data();
+    int * const last = first + debug_perf_size;
+    vec.assign(first, last);
+
+    std::vector<node<int>> nodes(debug_perf_size);
+    for (std::ptrdiff_t i = 0; i < debug_perf_size; ++i) {
+        nodes[i].value_ = unsorted[i];
+        nodes[i].next_ = i + 1 < debug_perf_size ? &nodes[i + 1] : nullptr;
+    }
+    node<int> * const head = nodes.data();
+
+#if defined(BOOST_STL_INTERFACES_DISABLE_FORCEINLINE)
+    std::printf("BOOST_STL_INTERFACES_DISABLE_FORCEINLINE defined\n");
+#else
+    std::printf("BOOST_STL_INTERFACES_FORCEINLINE enabled\n");
+#endif
+    std::printf(
+        "%-16s %10s %10s %9s\n", "ns/element", "pointer", "iterator", "ratio");
+
+    report(
+        "operator++",
+        time_sums(
+            reps,
+            [=] { return pointer_loops::increment_sum(first, last); },
+            [=] { return iterator_loops::increment_sum(first, last); }));
+
+    report(
+        "operator[]",
+        time_sums(
+            reps,
+            [=] {
+                return pointer_loops::subscript_sum(first, debug_perf_size);
+            },
+            [=] {
+                return iterator_loops::subscript_sum(first, debug_perf_size);
+            }));
+
+    report(
+        "container[]",
+        time_sums(
+            reps,
+            [=] {
+                return pointer_loops::container_sum(first, debug_perf_size);
+            },
+            [] { return iterator_loops::container_sum(vec); }));
+
+    report(
+        "node operator++",
+        time_sums(
+            reps,
+            [=] { return pointer_loops::node_sum(head); },
+            [=] { return iterator_loops::node_sum(head); }));
+
+    {
+        std::vector<int> pointer_sorted;
+        std::vector<int> iterator_sorted;
+        timing t;
+
+        clock_type::duration pointer_time{};
+        clock_type::duration iterator_time{};
+        for (int i = 0; i < reps; ++i) {
+            pointer_sorted = unsorted;
+            auto start = clock_type::now();
+            pointer_loops::sort(
+                pointer_sorted.data(),
+                pointer_sorted.data() + pointer_sorted.size());
+            pointer_time += clock_type::now() - start;
+
+            iterator_sorted = unsorted;
+            start = clock_type::now();
+            iterator_loops::sort(
+                iterator_sorted.data(),
+                iterator_sorted.data() + iterator_sorted.size());
+            iterator_time += clock_type::now() - start;
+        }
+        t.pointer_ns = ns_per_element(pointer_time, reps);
+        t.iterator_ns = ns_per_element(iterator_time, reps);
+
+        BOOST_TEST(iterator_sorted == pointer_sorted);
+        BOOST_TEST(
+            std::is_sorted(iterator_sorted.begin(), iterator_sorted.end()));
+        report("std::sort", t);
+    }
+
+    return boost::report_errors();
+}
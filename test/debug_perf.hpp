@@ -0,0 +1,44 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_TEST_DEBUG_PERF_HPP
+#define BOOST_STL_INTERFACES_TEST_DEBUG_PERF_HPP
+
+#include "../example/node_iterator.hpp"
+
+#include <boost/stl_interfaces/static_vector.hpp>
+
+#include <cstddef>
+
+
+// Each loop below is written once over raw pointers, in
+// debug_perf_pointer.cpp, and once over the interface-derived iterator and
+// container types, in debug_perf_iterator.cpp.  The iterators are the ones
+// from example/random_access_iterator.hpp and example/node_iterator.hpp.
+// Both files are built at -O0, so the difference in their run times and in
+// their .text sizes is what the CRTP forwarding layers cost in a debug build.
+
+constexpr std::ptrdiff_t debug_perf_size = 1 << 14;
+
+using debug_perf_vector =
+    boost::stl_interfaces::static_vector<int, debug_perf_size>;
+
+namespace pointer_loops {
+    long long increment_sum(int * first, int * last);
+    long long subscript_sum(int * first, std::ptrdiff_t n);
+    void sort(int * first, int * last);
+    long long container_sum(int const * first, std::ptrdiff_t n);
+    long long node_sum(node<int> * first);
+}
+
+namespace iterator_loops {
+    long long increment_sum(int * first, int * last);
+    long long subscript_sum(int * first, std::ptrdiff_t n);
+    void sort(int * first, int * last);
+    long long container_sum(debug_perf_vector const & v);
+    long long node_sum(node<int> * first);
+}
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "debug_perf.hpp"
+
+#include "../example/random_access_iterator.hpp"
+
+#include <algorithm>
+
+
+namespace iterator_loops {
+
+    long long increment_sum(int * first_, int * last_)
+    {
+        simple_random_access_iterator first(first_);
+        simple_random_access_iterator const last(last_);
+        long long retval = 0;
+        for (; first != last; ++first) {
+            retval += *first;
+        }
+        return retval;
+    }
+
+    long long subscript_sum(int * first_, std::ptrdiff_t n)
+    {
+        simple_random_access_iterator const first(first_);
+        long long retval = 0;
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+            retval += first[i];
+        }
+        return retval;
+    }
+
+    void sort(int * first, int * last)
+    {
+        std::sort(
+            simple_random_access_iterator(first),
+            simple_random_access_iterator(last));
+    }
+
+    long long container_sum(debug_perf_vector const & v)
+    {
+        long long retval = 0;
+        for (debug_perf_vector::size_type i = 0; i < v.size(); ++i) {
+            retval += v[i];
+        }
+        return retval;
+    }
+
+    long long node_sum(node<int> * first_)
+    {
+        node_iterator<int> first(first_);
+        node_iterator<int> const last;
+        long long retval = 0;
+        for (; first != last; ++first) {
+            retval += *first;
+        }
+        return retval;
+    }
+
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include "debug_perf.hpp"
+
+#include <algorithm>
+
+
+namespace pointer_loops {
+
+    long long increment_sum(int * first, int * last)
+    {
+        long long retval = 0;
+        for (; first != last; ++first) {
+            retval += *first;
+        }
+        return retval;
+    }
+
+    long long subscript_sum(int * first, std::ptrdiff_t n)
+    {
+        long long retval = 0;
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+            retval += first[i];
+        }
+        return retval;
+    }
+
+    void sort(int * first, int * last) { std::sort(first, last); }
+
+    long long container_sum(int const * first, std::ptrdiff_t n)
+    {
+        long long retval = 0;
+        for (std::ptrdiff_t i = 0; i < n; ++i) {
+            retval += first[i];
+        }
+        return retval;
+    }
+
+    long long node_sum(node<int> * first)
+    {
+        long long retval = 0;
+        for (; first; first = first->next_) {
+            retval += first->value_;
+        }
+        return retval;
+    }
+
+}
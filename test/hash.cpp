@@ -0,0 +1,110 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/hash.hpp>
+
+#include "../example/static_vector.hpp"
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <list>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using vec_type = static_vector<int, 10>;
+
+struct int_span : bsi::v1::view_interface<
+                      int_span,
+                      bsi::element_layout::contiguous>
+{
+    int_span() = default;
+    int_span(int const * first, int const * last) :
+        first_(first), last_(last)
+    {}
+    int const * begin() const { return first_; }
+    int const * end() const { return last_; }
+
+private:
+    int const * first_ = nullptr;
+    int const * last_ = nullptr;
+};
+
+template<typename T>
+using hash_value_expr = decltype(hash_value(std::declval<T const &>()));
+
+static_assert(bsi::detail::byte_hashable<vec_type>::value, "");
+static_assert(bsi::detail::byte_hashable<std::vector<int>>::value, "");
+static_assert(!bsi::detail::byte_hashable<std::list<int>>::value, "");
+static_assert(
+    !bsi::detail::byte_hashable<static_vector<std::string, 4>>::value, "");
+static_assert(boost::is_detected_v<hash_value_expr, vec_type>, "");
+static_assert(boost::is_detected_v<hash_value_expr, int_span>, "");
+
+struct vec_hash : bsi::range_hash
+{};
+
+
+int main()
+{
+
+// Equal contiguous ranges of the same elements hash the same, whatever their
+// types.
+{
+    vec_type const v = {1, 2, 3, 4, 5};
+    std::vector<int> const std_v = {1, 2, 3, 4, 5};
+    int_span const s(std_v.data(), std_v.data() + std_v.size());
+
+    BOOST_TEST(bsi::range_hash{}(v) == bsi::range_hash{}(std_v));
+    BOOST_TEST(hash_value(v) == bsi::range_hash{}(v));
+    BOOST_TEST(hash_value(s) == bsi::range_hash{}(v));
+
+    BOOST_TEST(hash_value(vec_type{}) == bsi::range_hash{}(std::vector<int>{}));
+    BOOST_TEST(hash_value(v) != hash_value(vec_type({1, 2, 3, 4})));
+    BOOST_TEST(hash_value(v) != hash_value(vec_type({1, 2, 3, 4, 6})));
+    BOOST_TEST(hash_value(vec_type({0})) != hash_value(vec_type({0, 0})));
+}
+
+// Lengths that do and do not fill whole words.
+{
+    std::vector<unsigned char> bytes;
+    std::vector<std::size_t> hashes;
+    for (int i = 0; i < 20; ++i) {
+        hashes.push_back(bsi::range_hash{}(bytes));
+        BOOST_TEST(bsi::range_hash{}(bytes) == hashes.back());
+        bytes.push_back((unsigned char)i);
+    }
+    std::unordered_set<std::size_t> const distinct(
+        hashes.begin(), hashes.end());
+    BOOST_TEST(distinct.size() == hashes.size());
+}
+
+// Elements without unique object representations are hashed one at a time.
+{
+    static_vector<std::string, 4> const v = {"a", "bc"};
+    static_vector<std::string, 4> const v2 = {"a", "bc"};
+    static_vector<std::string, 4> const v3 = {"ab", "c"};
+    BOOST_TEST(hash_value(v) == hash_value(v2));
+    BOOST_TEST(hash_value(v) != hash_value(v3));
+
+    std::list<int> const l = {1, 2, 3};
+    BOOST_TEST(bsi::range_hash{}(l) == bsi::range_hash{}(std::list<int>(l)));
+}
+
+// As the hash of an unordered container.
+{
+    std::unordered_set<vec_type, vec_hash> set;
+    set.insert(vec_type({1, 2}));
+    set.insert(vec_type({2, 1}));
+    set.insert(vec_type({1, 2}));
+    BOOST_TEST(set.size() == 2u);
+    BOOST_TEST(set.count(vec_type({2, 1})) == 1u);
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/instrumented_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <list>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using vec_iter = bsi::instrumented_iterator<std::vector<int>::iterator>;
+using list_iter = bsi::instrumented_iterator<std::list<int>::iterator>;
+
+BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT(
+    vec_iter, std::random_access_iterator)
+BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT(
+    list_iter, std::bidirectional_iterator)
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+static_assert(!std::random_access_iterator<list_iter>);
+static_assert(!std::sized_sentinel_for<list_iter, list_iter>);
+#endif
+
+#if defined(BOOST_STL_INTERFACES_INSTRUMENT_ITERATORS)
+static_assert(
+    std::is_same<
+        bsi::instrumented_t<int *>,
+        bsi::instrumented_iterator<int *>>::value,
+    "");
+#else
+static_assert(std::is_same<bsi::instrumented_t<int *>, int *>::value, "");
+#endif
+
+
+int main()
+{
+
+// Each kind of operation is counted separately.
+{
+    std::vector<int> vec = {0, 1, 2, 3, 4, 5, 6, 7};
+    bsi::instrumentation_counts() = bsi::iterator_op_counts{};
+
+    vec_iter first(vec.begin());
+    vec_iter const last(vec.end());
+    vec_iter it = first;
+    BOOST_TEST(*it == 0);
+    ++it;
+    it++;
+    --it;
+    it += 3;
+    it -= 1;
+    BOOST_TEST(it[1] == 4);
+    BOOST_TEST(last - first == 8);
+    BOOST_TEST(it != last);
+    BOOST_TEST(first < it);
+    BOOST_TEST(it.base() == vec.begin() + 3);
+
+    auto const counts = bsi::instrumentation_counts();
+    BOOST_TEST(counts.dereferences == 2u);
+    BOOST_TEST(counts.increments == 2u);
+    BOOST_TEST(counts.decrements == 1u);
+    BOOST_TEST(counts.jumps == 3u);
+    BOOST_TEST(counts.distances == 1u);
+    BOOST_TEST(counts.comparisons == 2u);
+}
+
+// Algorithms give the same results, and their costs can be observed.
+{
+    std::vector<int> vec;
+    for (int i = 0; i < 1024; ++i) {
+        vec.push_back((i * 37) % 1024);
+    }
+    std::sort(vec_iter(vec.begin()), vec_iter(vec.end()));
+    BOOST_TEST(std::is_sorted(vec.begin(), vec.end()));
+
+    std::list<int> const l(vec.begin(), vec.end());
+
+    bsi::instrumentation_counts() = bsi::iterator_op_counts{};
+    auto const vec_it =
+        std::lower_bound(vec_iter(vec.begin()), vec_iter(vec.end()), 500);
+    BOOST_TEST(*vec_it.base() == 500);
+    auto const vec_counts = bsi::instrumentation_counts();
+    BOOST_TEST(vec_counts.increments <= 11u);
+    BOOST_TEST(vec_counts.dereferences <= 11u);
+
+    using clist_iter =
+        bsi::instrumented_iterator<std::list<int>::const_iterator>;
+    bsi::instrumentation_counts() = bsi::iterator_op_counts{};
+    auto const list_it =
+        std::lower_bound(clist_iter(l.begin()), clist_iter(l.end()), 500);
+    BOOST_TEST(*list_it.base() == 500);
+    auto const list_counts = bsi::instrumentation_counts();
+    BOOST_TEST(1024u <= list_counts.increments);
+    BOOST_TEST(list_counts.dereferences <= 11u);
+    BOOST_TEST(list_counts.jumps == 0u);
+}
+
+    return boost::report_errors();
+}
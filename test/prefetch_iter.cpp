@@ -0,0 +1,140 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/prefetch_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <forward_list>
+#include <list>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+struct node
+{
+    int value_;
+    node * next_;
+};
+
+// A proxy iterator, which must say what to prefetch.
+struct node_value_iter : bsi::proxy_iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                             node_value_iter,
+#endif
+                             std::forward_iterator_tag,
+                             int>
+{
+    node_value_iter() : n_(nullptr) {}
+    explicit node_value_iter(node * n) : n_(n) {}
+
+    int operator*() const { return n_->value_; }
+    node_value_iter & operator++()
+    {
+        n_ = n_->next_;
+        return *this;
+    }
+    friend bool operator==(node_value_iter lhs, node_value_iter rhs)
+    {
+        return lhs.n_ == rhs.n_;
+    }
+
+    node const * prefetch_address() const { return n_; }
+
+    using base_type = bsi::proxy_iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+        node_value_iter,
+#endif
+        std::forward_iterator_tag,
+        int>;
+    using base_type::operator++;
+
+private:
+    node * n_;
+};
+
+BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT(
+    bsi::prefetch_iterator<node_value_iter>, std::forward_iterator)
+BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT(
+    bsi::prefetch_iterator<std::list<int>::iterator>, std::forward_iterator)
+
+template<typename Iter>
+std::vector<int> to_vector(Iter first, Iter last)
+{
+    std::vector<int> retval;
+    for (; first != last; ++first) {
+        retval.push_back(*first);
+    }
+    return retval;
+}
+
+
+int main()
+{
+
+// Several distances, over sequences shorter than, as long as, and longer than
+// the lookahead.
+{
+    for (int n = 0; n < 6; ++n) {
+        std::list<int> l;
+        for (int i = 0; i < n; ++i) {
+            l.push_back(i);
+        }
+        std::vector<int> const expected(l.begin(), l.end());
+
+        auto const last = bsi::make_prefetch_iterator<1>(l.end(), l.end());
+        BOOST_TEST(
+            to_vector(
+                bsi::make_prefetch_iterator<1>(l.begin(), l.end()), last) ==
+            expected);
+        BOOST_TEST(
+            to_vector(
+                bsi::make_prefetch_iterator(l.begin(), l.end()),
+                bsi::make_prefetch_iterator(l.end(), l.end())) == expected);
+        BOOST_TEST(
+            to_vector(
+                bsi::make_prefetch_iterator<8>(l.begin(), l.end()),
+                bsi::make_prefetch_iterator<8>(l.end(), l.end())) ==
+            expected);
+    }
+}
+
+// Writes through the adaptor, post-increment, and base().
+{
+    std::forward_list<int> fl = {1, 2, 3, 4};
+    auto it = bsi::make_prefetch_iterator(fl.begin(), fl.end());
+    auto const last = bsi::make_prefetch_iterator(fl.end(), fl.end());
+    *it++ = 10;
+    BOOST_TEST(it.base() == std::next(fl.begin()));
+    for (; it != last; ++it) {
+        *it *= 10;
+    }
+    BOOST_TEST(
+        std::vector<int>(fl.begin(), fl.end()) ==
+        std::vector<int>({10, 20, 30, 40}));
+
+    BOOST_TEST(
+        bsi::prefetch_iterator<int *>() == bsi::prefetch_iterator<int *>());
+}
+
+// A proxy iterator with prefetch_address().
+{
+    node nodes[5];
+    for (int i = 0; i < 5; ++i) {
+        nodes[i].value_ = i;
+        nodes[i].next_ = i < 4 ? &nodes[i + 1] : nullptr;
+    }
+    node_value_iter const first(&nodes[0]);
+    node_value_iter const last;
+    BOOST_TEST(
+        to_vector(
+            bsi::make_prefetch_iterator<3>(first, last),
+            bsi::make_prefetch_iterator<3>(last, last)) ==
+        std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+    return boost::report_errors();
+}
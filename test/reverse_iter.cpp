@@ -46,6 +46,49 @@ private:
     int * it2_;
 };
 
+// A bidirectional iterator that counts its steps.
+struct counting_iter : boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+                           counting_iter,
+#endif
+                           std::bidirectional_iterator_tag,
+                           int>
+{
+    counting_iter() : it_(nullptr), steps_(nullptr) {}
+    counting_iter(int * it, int & steps) : it_(it), steps_(&steps) {}
+
+    int & operator*() const { return *it_; }
+    counting_iter & operator++()
+    {
+        ++*steps_;
+        ++it_;
+        return *this;
+    }
+    counting_iter & operator--()
+    {
+        ++*steps_;
+        --it_;
+        return *this;
+    }
+    friend bool operator==(counting_iter lhs, counting_iter rhs) noexcept
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+#if !BOOST_STL_INTERFACES_USE_DEDUCED_THIS
+        counting_iter,
+#endif
+        std::bidirectional_iterator_tag,
+        int>;
+    using base_type::operator++;
+    using base_type::operator--;
+
+private:
+    int * it_;
+    int * steps_;
+};
+
 
 int main()
 {
@@ -241,5 +284,104 @@ int main()
     }
 }
 
+{
+    std::array<int, 10> ints = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    std::array<int, 10> const reversed = {{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}};
+    int steps = 0;
+
+    {
+        auto first = boost::stl_interfaces::make_reverse_iterator(
+            counting_iter(ints.data() + ints.size(), steps));
+        auto const last = boost::stl_interfaces::make_reverse_iterator(
+            counting_iter(ints.data(), steps));
+        BOOST_TEST(std::equal(first, last, reversed.begin(), reversed.end()));
+        BOOST_TEST(steps == 20);
+    }
+
+    steps = 0;
+    {
+        auto const first = boost::stl_interfaces::make_caching_reverse_iterator(
+            counting_iter(ints.data() + ints.size(), steps));
+        auto const last = boost::stl_interfaces::make_caching_reverse_iterator(
+            counting_iter(ints.data(), steps));
+        BOOST_TEST(std::equal(first, last, reversed.begin(), reversed.end()));
+        BOOST_TEST(steps == 10);
+
+        steps = 0;
+        std::size_t count = 0;
+        for (auto it = last; it != first; --it) {
+            ++count;
+        }
+        BOOST_TEST(count == ints.size());
+        BOOST_TEST(steps == 10);
+
+        // Decrementing fills the cache, so this is still one step per
+        // element.
+        steps = 0;
+        auto it = last;
+        for (int i = 0; i < 10; ++i) {
+            --it;
+            BOOST_TEST(*it == i);
+        }
+        BOOST_TEST(it == first);
+        BOOST_TEST(steps == 10);
+
+        // Incrementing without dereferencing still works.
+        it = first;
+        it++;
+        ++it;
+        BOOST_TEST(*it == 7);
+        BOOST_TEST(it.base() == counting_iter(ints.data() + 8, steps));
+        *it = 70;
+        BOOST_TEST(ints[7] == 70);
+    }
+}
+
+{
+    std::vector<int> ints = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    using iterator = boost::stl_interfaces::caching_reverse_iterator<
+        std::vector<int>::iterator>;
+    using const_iterator = boost::stl_interfaces::caching_reverse_iterator<
+        std::vector<int>::const_iterator>;
+    iterator const first(ints.end());
+    iterator const last(ints.begin());
+    const_iterator const cfirst = first;
+
+    BOOST_TEST(last - first == 10);
+    BOOST_TEST(first < last);
+    BOOST_TEST(first[3] == 6);
+    BOOST_TEST(*(first + 4) == 5);
+    BOOST_TEST(*(last - 1) == 0);
+    BOOST_TEST(*cfirst == 9);
+
+    auto it = first;
+    BOOST_TEST(*it == 9);
+    it += 2;
+    BOOST_TEST(*it == 7);
+    it -= 1;
+    BOOST_TEST(*it == 8);
+
+    std::vector<int> copy(first, last);
+    BOOST_TEST(copy == std::vector<int>({9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+}
+
+{
+    std::vector<int> ints = {0, 1, 2, 3};
+    auto const it = ints.begin() + 1;
+
+    // Reversing twice gives back the original iterator.
+    auto const rit = boost::stl_interfaces::make_reverse_iterator(it);
+    auto const it2 = boost::stl_interfaces::make_reverse_iterator(rit);
+    static_assert(std::is_same<decltype(it2), decltype(it)>::value, "");
+    BOOST_TEST(it2 == it);
+
+    auto const crit =
+        boost::stl_interfaces::make_caching_reverse_iterator(it);
+    auto const it3 =
+        boost::stl_interfaces::make_caching_reverse_iterator(crit);
+    static_assert(std::is_same<decltype(it3), decltype(it)>::value, "");
+    BOOST_TEST(it3 == it);
+}
+
     return boost::report_errors();
 }
@@ -0,0 +1,245 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/serialization.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include "../example/static_vector.hpp"
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#if BOOST_STL_INTERFACES_POSIX_IO
+#include <sys/wait.h>
+#endif
+
+
+namespace bsi = boost::stl_interfaces;
+
+using vec_type = static_vector<int, 10>;
+
+struct int_span : bsi::v1::view_interface<
+                      int_span,
+                      bsi::element_layout::contiguous>
+{
+    int_span(int const * first, int const * last) :
+        first_(first), last_(last)
+    {}
+    int const * begin() const { return first_; }
+    int const * end() const { return last_; }
+
+private:
+    int const * first_;
+    int const * last_;
+};
+
+struct point
+{
+    short x;
+    double y;
+};
+
+
+int main()
+{
+
+// Round trips through a buffer.
+{
+    vec_type const v = {1, 2, 3, 4, 5};
+    BOOST_TEST(
+        bsi::serialized_size(v) ==
+        sizeof(bsi::serialization_header) + 5 * sizeof(int));
+
+    std::vector<unsigned char> buf(bsi::serialized_size(v));
+    BOOST_TEST(bsi::write_to(v, buf.data(), buf.size()) == buf.size());
+
+    vec_type v2 = {9, 9};
+    BOOST_TEST(bsi::read_from(v2, buf.data(), buf.size()) == buf.size());
+    BOOST_TEST(v2 == v);
+
+    std::vector<int> std_v;
+    BOOST_TEST(bsi::read_from(std_v, buf.data(), buf.size()) == buf.size());
+    BOOST_TEST(std_v == std::vector<int>(v.begin(), v.end()));
+
+    int_span const s(std_v.data(), std_v.data() + std_v.size());
+    std::vector<unsigned char> buf2(bsi::serialized_size(s));
+    BOOST_TEST(bsi::write_to(s, buf2.data(), buf2.size()) == buf2.size());
+    BOOST_TEST(buf2 == buf);
+
+    vec_type const empty;
+    std::vector<unsigned char> buf3(bsi::serialized_size(empty));
+    BOOST_TEST(buf3.size() == sizeof(bsi::serialization_header));
+    BOOST_TEST(bsi::write_to(empty, buf3.data(), buf3.size()) == buf3.size());
+    BOOST_TEST(bsi::read_from(v2, buf3.data(), buf3.size()) == buf3.size());
+    BOOST_TEST(v2.empty());
+
+    static_vector<point, 3> const points = {{1, 1.5}, {2, 2.5}};
+    std::vector<unsigned char> buf4(bsi::serialized_size(points));
+    BOOST_TEST(bsi::write_to(points, buf4.data(), buf4.size()) == buf4.size());
+    std::vector<point> points2;
+    BOOST_TEST(
+        bsi::read_from(points2, buf4.data(), buf4.size()) == buf4.size());
+    BOOST_TEST(points2.size() == 2u);
+    BOOST_TEST(points2[1].x == 2);
+    BOOST_TEST(points2[1].y == 2.5);
+}
+
+// Failures leave the destination alone.
+{
+    vec_type const v = {1, 2, 3, 4, 5};
+    std::vector<unsigned char> buf(bsi::serialized_size(v));
+    BOOST_TEST(bsi::write_to(v, buf.data(), buf.size() - 1) == 0u);
+    bsi::write_to(v, buf.data(), buf.size());
+
+    vec_type v2 = {9, 9};
+    BOOST_TEST(bsi::read_from(v2, buf.data(), buf.size() - 1) == 0u);
+    BOOST_TEST(bsi::read_from(v2, buf.data(), 3) == 0u);
+    BOOST_TEST(v2 == vec_type({9, 9}));
+
+    using small_vec_type = static_vector<int, 4>;
+    small_vec_type too_small = {9};
+    BOOST_TEST(bsi::read_from(too_small, buf.data(), buf.size()) == 0u);
+    BOOST_TEST(too_small == small_vec_type({9}));
+
+    std::vector<long long> wrong_type = {9};
+    BOOST_TEST(bsi::read_from(wrong_type, buf.data(), buf.size()) == 0u);
+    BOOST_TEST(wrong_type == std::vector<long long>({9}));
+}
+
+// A count whose size in bytes would wrap is rejected, even by a container
+// that claims it could hold that many elements.
+{
+    struct unbounded
+    {
+        using size_type = std::size_t;
+        std::uint64_t * data() { return &x_; }
+        std::uint64_t const * data() const { return &x_; }
+        size_type max_size() const { return SIZE_MAX; }
+        void resize(size_type) { resized_ = true; }
+
+        std::uint64_t x_ = 0;
+        bool resized_ = false;
+    };
+
+    // 8 * (2^61 + 1) is 8, modulo 2^64.
+    bsi::serialization_header const h = {8u, (1ull << 61) + 1u};
+    unsigned char buf[sizeof(h) + 8] = {};
+    std::memcpy(buf, &h, sizeof(h));
+    unbounded c;
+    BOOST_TEST(bsi::read_from(c, buf, sizeof(buf)) == 0u);
+    BOOST_TEST(!c.resized_);
+}
+
+#if BOOST_STL_INTERFACES_POSIX_IO
+// Round trips through a file descriptor.
+{
+    std::FILE * f = std::tmpfile();
+    BOOST_TEST(f != nullptr);
+    if (f) {
+        int const fd = fileno(f);
+
+        std::vector<int> big(100000);
+        for (int i = 0; i < (int)big.size(); ++i) {
+            big[i] = i * 3;
+        }
+        vec_type const v = {1, 2, 3};
+        vec_type const empty;
+        BOOST_TEST(bsi::write_to(big, fd) == bsi::serialized_size(big));
+        BOOST_TEST(bsi::write_to(v, fd) == bsi::serialized_size(v));
+        BOOST_TEST(bsi::write_to(empty, fd) == bsi::serialized_size(empty));
+
+        BOOST_TEST(::lseek(fd, 0, SEEK_SET) == 0);
+        std::vector<int> big2;
+        vec_type v2 = {7};
+        BOOST_TEST(bsi::read_from(big2, fd) == bsi::serialized_size(big));
+        BOOST_TEST(big2 == big);
+        BOOST_TEST(bsi::read_from(v2, fd) == bsi::serialized_size(v));
+        BOOST_TEST(v2 == v);
+        BOOST_TEST(bsi::read_from(v2, fd) == bsi::serialized_size(empty));
+        BOOST_TEST(v2.empty());
+        BOOST_TEST(bsi::read_from(v2, fd) == 0u);
+
+        std::fclose(f);
+    }
+}
+
+// A count larger than what the file holds fails before resizing.
+{
+    std::FILE * f = std::tmpfile();
+    BOOST_TEST(f != nullptr);
+    if (f) {
+        int const fd = fileno(f);
+
+        bsi::serialization_header const h = {sizeof(int), 1ull << 40};
+        int const elements[2] = {1, 2};
+        BOOST_TEST(::write(fd, &h, sizeof(h)) == (::ssize_t)sizeof(h));
+        BOOST_TEST(
+            ::write(fd, elements, sizeof(elements)) ==
+            (::ssize_t)sizeof(elements));
+
+        BOOST_TEST(::lseek(fd, 0, SEEK_SET) == 0);
+        std::vector<int> v = {9};
+        BOOST_TEST(bsi::read_from(v, fd) == 0u);
+        BOOST_TEST(v == std::vector<int>({9}));
+        BOOST_TEST(v.capacity() == 1u);
+
+        std::fclose(f);
+    }
+}
+
+// From a pipe, whose size is unknown, a corrupt count only grows the
+// container a bounded amount past the data that actually arrives.
+{
+    int fds[2];
+    BOOST_TEST(::pipe(fds) == 0);
+
+    bsi::serialization_header const h = {sizeof(int), 1ull << 40};
+    int const elements[2] = {1, 2};
+    BOOST_TEST(::write(fds[1], &h, sizeof(h)) == (::ssize_t)sizeof(h));
+    BOOST_TEST(
+        ::write(fds[1], elements, sizeof(elements)) ==
+        (::ssize_t)sizeof(elements));
+    ::close(fds[1]);
+
+    std::vector<int> v;
+    BOOST_TEST(bsi::read_from(v, fds[0]) == 0u);
+    BOOST_TEST(v.size() <= (1u << 16) / sizeof(int));
+    ::close(fds[0]);
+}
+
+// From a pipe, a valid stream larger than one step is read in full.
+{
+    int fds[2];
+    BOOST_TEST(::pipe(fds) == 0);
+
+    std::vector<int> big(50000);
+    for (int i = 0; i < (int)big.size(); ++i) {
+        big[i] = i * 5;
+    }
+    ::pid_t const writer = ::fork();
+    BOOST_TEST(0 <= writer);
+    if (writer == 0) {
+        ::close(fds[0]);
+        std::size_t const written = bsi::write_to(big, fds[1]);
+        ::_exit(written == bsi::serialized_size(big) ? 0 : 1);
+    }
+    ::close(fds[1]);
+
+    std::vector<int> big2;
+    BOOST_TEST(bsi::read_from(big2, fds[0]) == bsi::serialized_size(big));
+    ::close(fds[0]);
+    int status = 0;
+    BOOST_TEST(::waitpid(writer, &status, 0) == writer);
+    BOOST_TEST(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    BOOST_TEST(big2 == big);
+}
+#endif
+
+    return boost::report_errors();
+}
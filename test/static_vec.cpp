@@ -10,6 +10,10 @@
 #include <boost/core/lightweight_test.hpp>
 
 #include <array>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
 
 // Instantiate all the members we can.
 template struct static_vector<int, 1024>;
@@ -160,6 +164,252 @@ void test_resize()
     }
 }
 
+void test_resize_for_overwrite()
+{
+    {
+        vec_type v = {1, 2};
+
+        static_assert(
+            std::is_same<decltype(v.resize_for_overwrite(1)), void>::value,
+            "");
+
+        v.resize_for_overwrite(5);
+        BOOST_TEST(v.size() == 5u);
+        BOOST_TEST(v[0] == 1);
+        BOOST_TEST(v[1] == 2);
+        std::fill(v.begin() + 2, v.end(), 3);
+        BOOST_TEST(v == vec_type({1, 2, 3, 3, 3}));
+
+        v.resize_for_overwrite(1);
+        BOOST_TEST(v == vec_type({1}));
+
+        // Growing to exactly capacity() is allowed.
+        v.resize_for_overwrite(v.capacity());
+        BOOST_TEST(v.size() == v.capacity());
+        BOOST_TEST(v[0] == 1);
+        v.resize(0);
+        v.resize(v.capacity(), 4);
+        BOOST_TEST(v.size() == v.capacity());
+        BOOST_TEST(v.back() == 4);
+        v.reserve(v.capacity());
+        v.clear();
+        std::vector<int> const full(v.capacity(), 5);
+        v.insert(v.end(), full.begin(), full.end());
+        BOOST_TEST(v.size() == v.capacity());
+    }
+
+    {
+        vec_type v = {1, 2};
+
+        static_assert(
+            std::is_same<
+                decltype(v.append_for_overwrite(1)),
+                vec_type::iterator>::value,
+            "");
+
+        auto const it = v.append_for_overwrite(3);
+        BOOST_TEST(it == v.begin() + 2);
+        BOOST_TEST(v.size() == 5u);
+        std::fill(it, v.end(), 7);
+        BOOST_TEST(v == vec_type({1, 2, 7, 7, 7}));
+
+        BOOST_TEST(v.append_for_overwrite(0) == v.end());
+    }
+}
+// A minimal container over std::vector that counts its reallocations.
+struct reserve_counting_vector
+    : sequence_container_interface<
+          reserve_counting_vector,
+          boost::stl_interfaces::element_layout::contiguous>
+{
+    using value_type = int;
+    using pointer = int *;
+    using const_pointer = int const *;
+    using reference = int &;
+    using const_reference = int const &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = int *;
+    using const_iterator = int const *;
+
+    reserve_counting_vector() = default;
+    template<typename Iter>
+    reserve_counting_vector(Iter first, Iter last) : vec_(first, last)
+    {}
+
+    iterator begin() noexcept { return vec_.data(); }
+    iterator end() noexcept { return vec_.data() + vec_.size(); }
+
+    size_type capacity() const noexcept { return vec_.capacity(); }
+    void reserve(size_type n)
+    {
+        if (vec_.capacity() < n)
+            ++reallocations;
+        vec_.reserve(n);
+    }
+
+    template<typename Iter>
+    iterator insert(const_iterator pos, Iter first, Iter last)
+    {
+        auto const offset = pos - begin();
+        auto const old_capacity = vec_.capacity();
+        vec_.insert(vec_.begin() + offset, first, last);
+        if (old_capacity != vec_.capacity())
+            ++reallocations;
+        return begin() + offset;
+    }
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto const offset = first - begin();
+        vec_.erase(vec_.begin() + offset, vec_.begin() + (last - begin()));
+        return begin() + offset;
+    }
+
+    void swap(reserve_counting_vector & other) { vec_.swap(other.vec_); }
+
+    using base_type = sequence_container_interface<
+        reserve_counting_vector,
+        boost::stl_interfaces::element_layout::contiguous>;
+    using base_type::begin;
+    using base_type::end;
+    using base_type::insert;
+    using base_type::erase;
+
+    int reallocations = 0;
+
+private:
+    std::vector<int> vec_;
+};
+
+void test_insert_append_assign_range()
+{
+    {
+        vec_type v = {1, 5};
+        std::vector<int> const vec = {2, 3, 4};
+        auto const it = v.insert_range(v.begin() + 1, vec);
+        BOOST_TEST(it == v.begin() + 1);
+        BOOST_TEST(v == vec_type({1, 2, 3, 4, 5}));
+
+        std::list<int> const l = {6, 7};
+        v.append_range(l);
+        BOOST_TEST(v == vec_type({1, 2, 3, 4, 5, 6, 7}));
+
+        v.assign_range(std::array<int, 3>{{9, 8, 7}});
+        BOOST_TEST(v == vec_type({9, 8, 7}));
+        v.assign_range(l);
+        BOOST_TEST(v == vec_type({6, 7}));
+
+        int const ints[] = {0, 1};
+        v.insert_range(v.begin(), ints);
+        BOOST_TEST(v == vec_type({0, 1, 6, 7}));
+    }
+
+    {
+        std::vector<int> const vec(100, 3);
+        reserve_counting_vector v;
+        v.append_range(vec);
+        BOOST_TEST(v.size() == 100u);
+        BOOST_TEST(v.reallocations == 1);
+
+        // The reserve() happens before the insert position is used.
+        v.reallocations = 0;
+        std::vector<int> const ones(1000, 1);
+        auto const it = v.insert_range(v.begin() + 50, ones);
+        BOOST_TEST(it == v.begin() + 50);
+        BOOST_TEST(v.reallocations == 1);
+        BOOST_TEST(v.size() == 1100u);
+        BOOST_TEST(v[49] == 3);
+        BOOST_TEST(v[50] == 1);
+        BOOST_TEST(v[1049] == 1);
+        BOOST_TEST(v[1050] == 3);
+
+        v.reallocations = 0;
+        std::vector<int> const twos(5000, 2);
+        v.assign_range(twos);
+        BOOST_TEST(v.reallocations == 1);
+        BOOST_TEST(v.size() == 5000u);
+        BOOST_TEST(v.back() == 2);
+    }
+}
+
+void test_input_iterator_insert()
+{
+    {
+        vec_type v = {1, 5};
+        std::istringstream is("2 3 4");
+        auto const it = v.insert(
+            v.begin() + 1,
+            std::istream_iterator<int>(is),
+            std::istream_iterator<int>());
+        BOOST_TEST(it == v.begin() + 1);
+        BOOST_TEST(v == vec_type({1, 2, 3, 4, 5}));
+    }
+
+    {
+        vec_type v = {1, 2};
+        std::istringstream is("3 4");
+        v.insert(
+            v.end(),
+            std::istream_iterator<int>(is),
+            std::istream_iterator<int>());
+        BOOST_TEST(v == vec_type({1, 2, 3, 4}));
+    }
+
+    {
+        vec_type v = {1, 2, 3, 4};
+        std::istringstream is("7 8");
+        v.assign(std::istream_iterator<int>(is), std::istream_iterator<int>());
+        BOOST_TEST(v == vec_type({7, 8}));
+    }
+
+    {
+        std::vector<int> vec = {0, 4};
+        std::istringstream is("1 2 3");
+        auto const it = boost::stl_interfaces::append_and_rotate(
+            vec,
+            vec.begin() + 1,
+            std::istream_iterator<int>(is),
+            std::istream_iterator<int>());
+        BOOST_TEST(it == vec.begin() + 1);
+        BOOST_TEST(vec == std::vector<int>({0, 1, 2, 3, 4}));
+    }
+}
+
+void test_erase_if()
+{
+    {
+        vec_type v = {1, 2, 3, 4, 5, 6, 7};
+        auto const n = erase_if(v, [](int x) { return x % 2 == 0; });
+        BOOST_TEST(n == 3u);
+        BOOST_TEST(v == vec_type({1, 3, 5, 7}));
+
+        BOOST_TEST(erase_if(v, [](int) { return false; }) == 0u);
+        BOOST_TEST(v == vec_type({1, 3, 5, 7}));
+        BOOST_TEST(erase_if(v, [](int) { return true; }) == 4u);
+        BOOST_TEST(v.empty());
+        BOOST_TEST(erase_if(v, [](int) { return true; }) == 0u);
+    }
+
+    {
+        vec_type v = {3, 1, 3, 3, 2, 3};
+        BOOST_TEST(erase(v, 3) == 4u);
+        BOOST_TEST(v == vec_type({1, 2}));
+        BOOST_TEST(erase(v, 4) == 0u);
+        BOOST_TEST(v == vec_type({1, 2}));
+    }
+
+    {
+        // Elements that are not trivially copyable take the std::remove_if()
+        // path.
+        static_vector<std::string, 10> v = {"a", "bb", "c", "dd"};
+        BOOST_TEST(
+            erase_if(v, [](std::string const & s) { return s.size() == 2; }) ==
+            2u);
+        BOOST_TEST(v.size() == 2u);
+        BOOST_TEST(v[0] == "a");
+        BOOST_TEST(v[1] == "c");
+    }
+}
 
 void test_assignment_copy_move_equality()
 {
@@ -761,6 +1011,10 @@ int main()
     test_default_ctor();
     test_other_ctors_assign_ctor();
     test_resize();
+    test_resize_for_overwrite();
+    test_insert_append_assign_range();
+    test_input_iterator_insert();
+    test_erase_if();
     test_assignment_copy_move_equality();
     test_comparisons();
     test_swap();
@@ -0,0 +1,532 @@
+// Copyright (C) 2026 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/views.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+#include <ranges>
+#endif
+
+
+namespace bsi = boost::stl_interfaces;
+
+// Range-based for requires a common range before C++17.
+template<typename R>
+std::vector<int> to_vector(R && r)
+{
+    std::vector<int> retval;
+    for (auto first = r.begin(); first != r.end(); ++first) {
+        retval.push_back(*first);
+    }
+    return retval;
+}
+
+using vec_iter = std::vector<int>::iterator;
+using vec_citer = std::vector<int>::const_iterator;
+
+struct special_members
+{
+    int copies = 0;
+    int moves = 0;
+};
+
+// A range that counts how many times it is copied and moved.
+struct counting_vector
+{
+    counting_vector(special_members & counts, std::initializer_list<int> il) :
+        counts_(&counts), vec_(il)
+    {}
+    counting_vector(counting_vector const & other) :
+        counts_(other.counts_), vec_(other.vec_)
+    {
+        ++counts_->copies;
+    }
+    counting_vector(counting_vector && other) :
+        counts_(other.counts_), vec_(std::move(other.vec_))
+    {
+        ++counts_->moves;
+    }
+    counting_vector & operator=(counting_vector const & other)
+    {
+        vec_ = other.vec_;
+        ++counts_->copies;
+        return *this;
+    }
+    counting_vector & operator=(counting_vector && other)
+    {
+        vec_ = std::move(other.vec_);
+        ++counts_->moves;
+        return *this;
+    }
+
+    vec_iter begin() { return vec_.begin(); }
+    vec_iter end() { return vec_.end(); }
+    vec_citer begin() const { return vec_.begin(); }
+    vec_citer end() const { return vec_.end(); }
+    std::size_t size() const { return vec_.size(); }
+
+private:
+    special_members * counts_;
+    std::vector<int> vec_;
+};
+
+// Makes a subrange of its argument, counting calls; when its argument is
+// already such a subrange, it simplifies to returning the argument.
+struct counting_impl
+{
+    template<typename R, typename... Args>
+    auto operator()(R && r, Args...) const
+        -> bsi::subrange<decltype(r.begin())>
+    {
+        ++*called_;
+        return bsi::subrange<decltype(r.begin())>(r.begin(), r.end());
+    }
+
+    template<typename... Args>
+    bsi::subrange<vec_iter>
+    simplify(bsi::subrange<vec_iter> r, Args...) const
+    {
+        ++*simplified_;
+        return r;
+    }
+
+    int * called_;
+    int * simplified_;
+};
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+static_assert(std::ranges::view<bsi::subrange<int *>>);
+static_assert(std::ranges::contiguous_range<bsi::subrange<int *>>);
+static_assert(std::ranges::borrowed_range<bsi::subrange<vec_iter>>);
+static_assert(
+    std::ranges::view<bsi::take_view<bsi::subrange<std::list<int>::iterator>>>);
+static_assert(std::ranges::bidirectional_range<
+              bsi::take_view<bsi::subrange<std::list<int>::iterator>>>);
+static_assert(std::ranges::view<
+              bsi::take_view<bsi::owning_view<std::vector<int>>>>);
+static_assert(!std::ranges::borrowed_range<
+              bsi::take_view<bsi::owning_view<std::vector<int>>>>);
+static_assert(std::random_access_iterator<bsi::repeat_iterator<int>>);
+static_assert(std::random_access_iterator<bsi::iota_iterator<int>>);
+static_assert(std::ranges::sized_range<bsi::repeat_n_view<int>>);
+static_assert(std::ranges::sized_range<bsi::iota_view<int>>);
+static_assert(std::ranges::borrowed_range<bsi::iota_view<int>>);
+static_assert(std::ranges::view<bsi::ref_view<std::vector<int>>>);
+static_assert(std::ranges::borrowed_range<bsi::ref_view<std::vector<int>>>);
+static_assert(std::ranges::view<bsi::owning_view<std::vector<int>>>);
+static_assert(
+    !std::ranges::borrowed_range<bsi::owning_view<std::vector<int>>>);
+static_assert(
+    std::ranges::contiguous_range<bsi::owning_view<std::vector<int>>>);
+#endif
+
+
+int main()
+{
+
+// subrange
+{
+    std::vector<int> vec = {0, 1, 2, 3, 4};
+    bsi::subrange<int *> sr(vec.data() + 1, vec.data() + 4);
+    BOOST_TEST(sr.size() == 3);
+    BOOST_TEST(sr.front() == 1);
+    BOOST_TEST(sr.back() == 3);
+    BOOST_TEST(sr.data() == vec.data() + 1);
+    BOOST_TEST(to_vector(sr) == std::vector<int>({1, 2, 3}));
+
+    bsi::subrange<int *> const empty;
+    BOOST_TEST(empty.empty());
+}
+
+// take() on random access ranges produces a subrange.
+{
+    std::vector<int> vec = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    auto taken = bsi::views::take(vec, 3);
+    static_assert(
+        std::is_same<decltype(taken), bsi::subrange<vec_iter>>::value, "");
+    BOOST_TEST(taken.begin() == vec.begin());
+    BOOST_TEST(taken.end() == vec.begin() + 3);
+    BOOST_TEST(to_vector(taken) == std::vector<int>({0, 1, 2}));
+
+    auto piped = vec | bsi::views::take(3);
+    static_assert(
+        std::is_same<decltype(piped), bsi::subrange<vec_iter>>::value, "");
+    BOOST_TEST(piped.end() == vec.begin() + 3);
+
+    BOOST_TEST((vec | bsi::views::take(100)).end() == vec.end());
+    BOOST_TEST((vec | bsi::views::take(0)).empty());
+
+    std::vector<int> const & cvec = vec;
+    auto ctaken = cvec | bsi::views::take(2);
+    static_assert(
+        std::is_same<decltype(ctaken), bsi::subrange<vec_citer>>::value, "");
+    BOOST_TEST(to_vector(ctaken) == std::vector<int>({0, 1}));
+
+    // Taking from a subrange keeps the subrange's iterators, even when the
+    // subrange is an rvalue.
+    auto twice = bsi::subrange<int *>(vec.data(), vec.data() + 8) |
+                 bsi::views::take(5) | bsi::views::take(2);
+    static_assert(
+        std::is_same<decltype(twice), bsi::subrange<int *>>::value, "");
+    BOOST_TEST(twice.data() == vec.data());
+    BOOST_TEST(twice.size() == 2);
+}
+
+// take() on other ranges produces a take_view.
+{
+    std::list<int> list = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    auto taken = list | bsi::views::take(3);
+    BOOST_TEST(taken.count() == 3);
+    BOOST_TEST(to_vector(taken) == std::vector<int>({0, 1, 2}));
+    BOOST_TEST(to_vector(list | bsi::views::take(100)) == to_vector(list));
+    BOOST_TEST((list | bsi::views::take(0)).empty());
+    BOOST_TEST(!taken.empty());
+
+    auto it = taken.begin();
+    ++it;
+    ++it;
+    BOOST_TEST(*it == 2);
+    BOOST_TEST(it.count() == 1);
+    --it;
+    BOOST_TEST(*it == 1);
+    BOOST_TEST(it.count() == 2);
+    it++;
+    ++it;
+    BOOST_TEST(it == taken.end());
+    BOOST_TEST(!(it != taken.end()));
+}
+
+// take() on an rvalue takes ownership of it, and still uses its iterators
+// when it is random access.
+{
+    auto taken = std::vector<int>{0, 1, 2, 3, 4} | bsi::views::take(3);
+    static_assert(
+        std::is_same<
+            decltype(taken),
+            bsi::take_view<bsi::owning_view<std::vector<int>>>>::value,
+        "");
+    static_assert(std::is_same<decltype(taken.begin()), vec_iter>::value, "");
+    static_assert(std::is_same<decltype(taken.end()), vec_iter>::value, "");
+    BOOST_TEST(taken.size() == 3);
+    BOOST_TEST(to_vector(taken) == std::vector<int>({0, 1, 2}));
+
+    auto const & ctaken = taken;
+    static_assert(
+        std::is_same<decltype(ctaken.begin()), vec_citer>::value, "");
+    BOOST_TEST(to_vector(ctaken) == std::vector<int>({0, 1, 2}));
+
+    BOOST_TEST(std::move(taken).base().size() == 5u);
+}
+
+// take(take(r, m), n) is take(r, min(m, n)).
+{
+    std::list<int> list = {0, 1, 2, 3, 4, 5, 6, 7};
+    using list_take_view =
+        bsi::take_view<bsi::subrange<std::list<int>::iterator>>;
+
+    auto taken = list | bsi::views::take(5) | bsi::views::take(2);
+    static_assert(std::is_same<decltype(taken), list_take_view>::value, "");
+    BOOST_TEST(taken.count() == 2);
+    BOOST_TEST(to_vector(taken) == std::vector<int>({0, 1}));
+
+    auto const taken_again = bsi::views::take(taken, 7);
+    static_assert(
+        std::is_same<decltype(taken_again), list_take_view const>::value, "");
+    BOOST_TEST(taken_again.count() == 2);
+
+    auto owned = std::vector<int>{0, 1, 2, 3, 4} | bsi::views::take(4) |
+                 bsi::views::take(2) | bsi::views::take(3);
+    static_assert(
+        std::is_same<
+            decltype(owned),
+            bsi::take_view<bsi::owning_view<std::vector<int>>>>::value,
+        "");
+    BOOST_TEST(owned.count() == 2);
+    BOOST_TEST(to_vector(owned) == std::vector<int>({0, 1}));
+}
+
+// reverse()
+{
+    std::vector<int> vec = {0, 1, 2, 3, 4};
+    auto const rvec = std::vector<int>({4, 3, 2, 1, 0});
+
+    auto reversed = vec | bsi::views::reverse;
+    BOOST_TEST(to_vector(reversed) == rvec);
+    BOOST_TEST(reversed.begin().base() == vec.end());
+    BOOST_TEST(to_vector(bsi::views::reverse(vec)) == rvec);
+
+    // reverse | reverse is the identity.
+    auto same = vec | bsi::views::reverse | bsi::views::reverse;
+    static_assert(
+        std::is_same<decltype(same), bsi::subrange<vec_iter>>::value, "");
+    BOOST_TEST(same.begin() == vec.begin());
+    BOOST_TEST(same.end() == vec.end());
+
+    auto last_two = vec | bsi::views::reverse | bsi::views::take(2);
+    static_assert(
+        std::is_same<decltype(last_two), decltype(reversed)>::value, "");
+    BOOST_TEST(to_vector(last_two) == std::vector<int>({4, 3}));
+
+    auto owned = std::vector<int>{0, 1, 2} | bsi::views::reverse;
+    static_assert(
+        std::is_same<
+            decltype(owned),
+            bsi::reverse_view<bsi::owning_view<std::vector<int>>>>::value,
+        "");
+    BOOST_TEST(to_vector(owned) == std::vector<int>({2, 1, 0}));
+
+    auto unreversed = std::move(owned) | bsi::views::reverse;
+    static_assert(
+        std::is_same<
+            decltype(unreversed),
+            bsi::owning_view<std::vector<int>>>::value,
+        "");
+    BOOST_TEST(unreversed.base() == std::vector<int>({0, 1, 2}));
+
+    auto const owned2 = std::vector<int>{0, 1, 2} | bsi::views::reverse;
+    auto same2 = owned2 | bsi::views::reverse;
+    static_assert(
+        std::is_same<decltype(same2), bsi::subrange<vec_citer>>::value, "");
+    BOOST_TEST(to_vector(same2) == std::vector<int>({0, 1, 2}));
+}
+
+// User-defined adaptors can simplify too.
+{
+    std::vector<int> vec = {0, 1, 2, 3, 4};
+    int simplified = 0;
+    int called = 0;
+
+    auto const count_calls =
+        bsi::adaptor<counting_impl>(counting_impl{&called, &simplified});
+    auto const counted = vec | count_calls(1);
+    BOOST_TEST(counted.size() == 5);
+    BOOST_TEST(called == 1);
+    BOOST_TEST(simplified == 0);
+
+    auto const counted_again = counted | count_calls(1);
+    BOOST_TEST(counted_again.size() == 5);
+    BOOST_TEST(called == 1);
+    BOOST_TEST(simplified == 1);
+
+    bsi::closure<counting_impl> const count_all(
+        counting_impl{&called, &simplified});
+    count_all(counted);
+    count_all(vec);
+    BOOST_TEST(called == 2);
+    BOOST_TEST(simplified == 2);
+    count_calls(counted, 1);
+    BOOST_TEST(simplified == 3);
+}
+
+// all()
+{
+    std::vector<int> vec = {0, 1, 2, 3};
+
+    auto ref = vec | bsi::views::all;
+    static_assert(
+        std::is_same<decltype(ref), bsi::ref_view<std::vector<int>>>::value,
+        "");
+    BOOST_TEST(&ref.base() == &vec);
+    BOOST_TEST(ref.size() == 4u);
+    BOOST_TEST(to_vector(ref) == vec);
+
+    // all() of a view is the view itself.
+    auto ref2 = bsi::views::all(bsi::views::all(vec));
+    static_assert(std::is_same<decltype(ref2), decltype(ref)>::value, "");
+    static_assert(
+        std::is_same<
+            bsi::views::all_t<bsi::subrange<int *>>,
+            bsi::subrange<int *>>::value,
+        "");
+
+    std::list<int> const list = {0, 1, 2};
+    auto cref = bsi::views::all(list);
+    BOOST_TEST(cref.size() == 3u);
+    BOOST_TEST(to_vector(cref) == std::vector<int>({0, 1, 2}));
+}
+{
+    special_members counts;
+    auto owned = counting_vector(counts, {0, 1, 2, 3}) | bsi::views::all;
+    static_assert(
+        std::is_same<decltype(owned), bsi::owning_view<counting_vector>>::
+            value,
+        "");
+    BOOST_TEST(counts.copies == 0);
+    BOOST_TEST(counts.moves == 1);
+    BOOST_TEST(owned.size() == 4u);
+    BOOST_TEST(to_vector(owned) == std::vector<int>({0, 1, 2, 3}));
+
+    auto taken = std::move(owned) | bsi::views::all | bsi::views::take(2);
+    static_assert(
+        std::is_same<decltype(taken.begin()), vec_iter>::value, "");
+    BOOST_TEST(counts.copies == 0);
+    BOOST_TEST(to_vector(taken) == std::vector<int>({0, 1}));
+
+    // Borrowed views of an owning_view still refer to it.
+    auto owned2 = counting_vector(counts, {0, 1, 2}) | bsi::views::all;
+    auto reversed = owned2 | bsi::views::reverse;
+    BOOST_TEST(to_vector(reversed) == std::vector<int>({2, 1, 0}));
+    BOOST_TEST(counts.copies == 0);
+
+    auto const v = std::vector<int>{0, 1, 2, 3} | bsi::views::all |
+                   bsi::views::take(3) | bsi::views::reverse;
+    BOOST_TEST(to_vector(v) == std::vector<int>({2, 1, 0}));
+}
+
+// Piping a temporary into an adaptor moves it into an owning_view exactly
+// once, and never copies it.
+{
+    special_members counts;
+    auto taken = counting_vector(counts, {0, 1, 2, 3}) | bsi::views::take(2);
+    static_assert(
+        std::is_same<
+            decltype(taken),
+            bsi::take_view<bsi::owning_view<counting_vector>>>::value,
+        "");
+    BOOST_TEST(counts.copies == 0);
+    BOOST_TEST(counts.moves == 1);
+    BOOST_TEST(to_vector(taken) == std::vector<int>({0, 1}));
+}
+{
+    special_members counts;
+    auto reversed = counting_vector(counts, {0, 1, 2}) | bsi::views::reverse;
+    static_assert(
+        std::is_same<
+            decltype(reversed),
+            bsi::reverse_view<bsi::owning_view<counting_vector>>>::value,
+        "");
+    BOOST_TEST(counts.copies == 0);
+    BOOST_TEST(counts.moves == 1);
+    BOOST_TEST(to_vector(reversed) == std::vector<int>({2, 1, 0}));
+
+    // Later adaptors move the view along, but never copy it.
+    auto chain = std::move(reversed) | bsi::views::take(2) |
+                 bsi::views::reverse;
+    BOOST_TEST(counts.copies == 0);
+    BOOST_TEST(to_vector(chain) == std::vector<int>({1, 2}));
+}
+
+// repeat_n() and iota()
+{
+    auto const pad = bsi::views::repeat_n('-', 5);
+    BOOST_TEST(pad.size() == 5);
+    BOOST_TEST(pad[4] == '-');
+    BOOST_TEST(pad.end() - pad.begin() == 5);
+    BOOST_TEST(std::string(pad.begin(), pad.end()) == "-----");
+    BOOST_TEST(bsi::views::repeat_n(std::string("ab"), 0).empty());
+    BOOST_TEST(
+        bsi::views::repeat_n(std::string("ab"), 2).front() ==
+        std::string("ab"));
+
+    auto const indices = bsi::views::iota(3, 8);
+    BOOST_TEST(indices.size() == 5);
+    BOOST_TEST(indices[2] == 5);
+    BOOST_TEST(indices.back() == 7);
+    BOOST_TEST(to_vector(indices) == std::vector<int>({3, 4, 5, 6, 7}));
+    BOOST_TEST(bsi::views::iota(3, 3).empty());
+
+    auto const bytes = bsi::views::iota((unsigned char)250, (unsigned char)255);
+    BOOST_TEST(bytes.size() == 5);
+    BOOST_TEST(*(bytes.begin() + 4) == 254);
+
+    // iota_views are borrowed, so taking from an rvalue is still a subrange.
+    auto const taken = bsi::views::iota(0, 100) | bsi::views::take(3);
+    static_assert(
+        std::is_same<
+            decltype(taken),
+            bsi::subrange<bsi::iota_iterator<int>> const>::value,
+        "");
+    BOOST_TEST(to_vector(taken) == std::vector<int>({0, 1, 2}));
+}
+
+// filter
+{
+    auto const odd = [](int x) { return x % 2 != 0; };
+    for (int n : {0, 1, 31, 32, 33, 64, 65, 100}) {
+        std::vector<int> vec;
+        for (int i = 0; i < n; ++i) {
+            vec.push_back((i * 7) % 11);
+        }
+        std::vector<int> expected;
+        std::copy_if(
+            vec.begin(), vec.end(), std::back_inserter(expected), odd);
+
+        BOOST_TEST(to_vector(bsi::views::filter(vec, odd)) == expected);
+        BOOST_TEST(to_vector(vec | bsi::views::filter(odd)) == expected);
+    }
+
+    // No elements, or every element, selected.
+    std::vector<int> const vec(70, 2);
+    BOOST_TEST(to_vector(vec | bsi::views::filter(odd)).empty());
+    BOOST_TEST(
+        to_vector(vec | bsi::views::filter([](int) { return true; })) ==
+        vec);
+
+    // The predicate sees each element exactly once.
+    int calls = 0;
+    auto counted = vec | bsi::views::filter([&calls](int x) {
+                       ++calls;
+                       return x != 0;
+                   });
+    BOOST_TEST(std::distance(counted.begin(), counted.end()) == 70);
+    BOOST_TEST(calls == 70);
+}
+
+{
+    // Selected elements can be written through the view.
+    std::vector<int> vec = {0, 1, 2, 3, 4, 5, 6, 7};
+    auto evens = vec | bsi::views::filter([](int x) { return x % 2 == 0; });
+    for (auto it = evens.begin(), last = evens.end(); it != last; ++it) {
+        *it = -*it;
+    }
+    BOOST_TEST(vec == std::vector<int>({0, 1, -2, 3, -4, 5, -6, 7}));
+
+    // An owned rvalue source.
+    auto big = std::vector<int>{5, 50, 6, 60} |
+               bsi::views::filter([](int x) { return 10 < x; });
+    BOOST_TEST(to_vector(big) == std::vector<int>({50, 60}));
+
+    // Floating point elements, through a pointer-based subrange.
+    double const doubles[] = {0.5, -1.0, 2.5, -3.0};
+    bsi::subrange<double const *> sub(doubles, doubles + 4);
+    auto negative = sub | bsi::views::filter([](double x) { return x < 0; });
+    auto it = negative.begin();
+    BOOST_TEST(*it == -1.0);
+    BOOST_TEST(*++it == -3.0);
+    BOOST_TEST(++it == negative.end());
+}
+
+#if BOOST_STL_INTERFACES_USE_CONCEPTS
+// take() combines with the std views.
+{
+    std::vector<int> vec = {0, 1, 2, 3, 4, 5, 6, 7};
+    BOOST_TEST(
+        to_vector(vec | std::views::reverse | bsi::views::take(3)) ==
+        std::vector<int>({7, 6, 5}));
+    BOOST_TEST(
+        to_vector(vec | bsi::views::take(3) | std::views::reverse) ==
+        std::vector<int>({2, 1, 0}));
+    BOOST_TEST(
+        to_vector(
+            std::vector<int>{0, 1, 2} | bsi::views::all |
+            std::views::transform([](int x) { return x * 2; })) ==
+        std::vector<int>({0, 2, 4}));
+}
+#endif
+
+    return boost::report_errors();
+}